@@ -0,0 +1,71 @@
+// Bench.cpp
+//
+// Helpers declared in Bench.h.
+
+#include "pch.h"
+#include "Bench.h"
+#include <cstdio>
+#include <random>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace ss_bench {
+    namespace fs = std::filesystem;
+
+    double msSince(clock::time_point t0) {
+        return std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+    }
+
+    fs::path benchRoot() {
+        std::error_code ec;
+        auto tmp = fs::temp_directory_path(ec);
+        return (ec ? fs::path(".") : tmp) / "suitespot_bench";
+    }
+
+    std::uint64_t peakRssKb() {
+#if defined(_WIN32)
+        PROCESS_MEMORY_COUNTERS pmc{};
+        if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return pmc.PeakWorkingSetSize / 1024;
+        return 0;
+#else
+        rusage ru{};
+        if (getrusage(RUSAGE_SELF, &ru) == 0) return static_cast<std::uint64_t>(ru.ru_maxrss);
+        return 0;
+#endif
+    }
+
+    std::vector<std::string> makeMapNames(int count) {
+        static const char* const kWords[] = {
+            "DFH", "Stadium", "Mannfield", "Champions", "Field", "Utopia", "Coliseum", "Wasteland", "Neo",
+            "Tokyo", "Beckwith", "Park", "Urban", "Central", "Salty", "Shores", "Farmstead", "Forbidden",
+            "Temple", "Dribble", "Challenge", "Obstacle", "Course", "Rings", "Lethamyr", "Speed", "Jump",
+            "Aerial", "Training", "Pro", "Ultimate", "Air", "Roll", "Giant", "Tiny", "Hoops", "Dunk" };
+        static const char* const kVariants[] = { "", " (Snowy)", " (Night)", " (Stormy)", " (Dawn)", " v2" };
+        std::mt19937 rng(4242);
+        std::vector<std::string> names;
+        names.reserve(static_cast<std::size_t>(count));
+        for (int i = 0; i < count; ++i) {
+            std::string n;
+            const int words = 1 + static_cast<int>(rng() % 4);
+            for (int w = 0; w < words; ++w) {
+                if (w) n += ' ';
+                n += kWords[rng() % (sizeof(kWords) / sizeof(kWords[0]))];
+            }
+            n += kVariants[rng() % (sizeof(kVariants) / sizeof(kVariants[0]))];
+            n += ' ';
+            n += std::to_string(i % 997);
+            names.push_back(std::move(n));
+        }
+        return names;
+    }
+
+    void emit(const std::string& json) {
+        std::printf("%s\n", json.c_str());
+        std::fflush(stdout);
+    }
+}
@@ -0,0 +1,41 @@
+// Bench.h
+//
+// Pieces shared by the benchmark executables: the timing helpers, the
+// scratch folder and the synthetic map names, plus the entry point of each
+// suitespot_bench benchmark (one .cpp per benchmark).
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace ss_bench {
+    using clock = std::chrono::steady_clock;
+
+    double msSince(clock::time_point t0);
+
+    // Synthetic inputs live under %TEMP%/suitespot_bench and are reused
+    // across runs.
+    std::filesystem::path benchRoot();
+
+    // Peak resident set of this process in KiB.
+    std::uint64_t peakRssKb();
+
+    // `count` map names built from stadium / workshop vocabulary, with a
+    // variant suffix and a number so most of them are distinct.
+    std::vector<std::string> makeMapNames(int count);
+
+    // Writes one JSON result line to stdout.
+    void emit(const std::string& json);
+
+    // suitespot_bench entry points. args[0] is the benchmark's name; the
+    // return value is the process exit code.
+    int discovery(const std::vector<std::string>& args);
+    int titles(const std::vector<std::string>& args);
+    int training(const std::vector<std::string>& args);
+    int fuzzy(const std::vector<std::string>& args);
+    int fonts(const std::vector<std::string>& args);
+}
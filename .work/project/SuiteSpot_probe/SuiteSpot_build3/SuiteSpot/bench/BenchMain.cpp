@@ -0,0 +1,46 @@
+// BenchMain.cpp
+//
+// suitespot_bench: benchmarks for SuiteSpot's hot paths, run outside the
+// game against the stub host in HostStubs.cpp.
+//
+//   suitespot_bench <name> [args...]
+//
+// Each benchmark prints one JSON object per result on stdout so numbers
+// can be compared between builds; plugin log lines go to stderr.
+
+#include "pch.h"
+#include "Bench.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    struct Entry {
+        const char* name;
+        int (*run)(const std::vector<std::string>& args);
+        const char* usage;
+    };
+
+    const Entry kBenches[] = {
+        { "discovery", ss_bench::discovery, "[maps] [depth] [sidecar%] [decoys] | sweep" },
+        { "titles", ss_bench::titles, "[dir]" },
+        { "training", ss_bench::training, "[lines]" },
+        { "fuzzy", ss_bench::fuzzy, "[names]" },
+        { "fonts", ss_bench::fonts, "[px...]" },
+    };
+
+    int usage(const char* exe) {
+        std::fprintf(stderr, "usage: %s <name> [args...]\n", exe);
+        for (const auto& b : kBenches) std::fprintf(stderr, "  %s %s\n", b.name, b.usage);
+        return 2;
+    }
+}
+
+int main(int argc, char** argv) {
+    if (argc < 2) return usage(argv[0]);
+    for (const auto& b : kBenches) {
+        if (std::strcmp(argv[1], b.name) != 0) continue;
+        _globalCvarManager = std::make_shared<CVarManagerWrapper>();
+        return b.run(std::vector<std::string>(argv + 1, argv + argc));
+    }
+    return usage(argv[0]);
+}
@@ -0,0 +1,221 @@
+// DiscoveryBench.cpp
+//
+//   suitespot_bench discovery [maps] [depth] [sidecar%] [decoys]
+//   suitespot_bench discovery sweep
+//
+// Times the workshop discovery paths against a generated library (see
+// makeWorkshopTree): the index scan behind LoadWorkshopMaps, cold and
+// warm, DiscoverWorkshopInDir, root detection and the mirror with and
+// without the dedup store. `sweep` runs 100..50000 maps at depths 0 and 3.
+
+#include "pch.h"
+#include "Bench.h"
+#include "SuiteSpot.h"
+#include "WorkshopCatalog.h"
+#include "WorkshopHelpers.h"
+#include "WorkshopIndex.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace {
+    namespace fs = std::filesystem;
+    using ss_bench::benchRoot;
+    using ss_bench::msSince;
+
+    // Shape of a generated workshop library.
+    struct TreeSpec {
+        int maps = 5000;       // map files (.upk)
+        int depth = 1;         // extra folders between the item folder and its map
+        int sidecarPct = 50;   // share of maps with a .json sidecar
+        int decoys = 2;        // non-map files per item folder
+
+        std::string tag() const {
+            return "m" + std::to_string(maps) + "_d" + std::to_string(depth) +
+                   "_j" + std::to_string(sidecarPct) + "_x" + std::to_string(decoys);
+        }
+    };
+
+    // Builds a Steam-style library: one numbered item folder per map, the
+    // map `depth` folders further down, an optional sidecar next to it and
+    // a few decoy files (preview images, readmes, .upk.bak leftovers) in
+    // the item folder. Every 10th item keeps its map at the top level
+    // instead, like loose Epic mods. A marker file makes reruns reuse the
+    // tree. Returns the total number of files written.
+    std::size_t makeWorkshopTree(const fs::path& root, const TreeSpec& spec) {
+        std::error_code ec;
+        const auto marker = root / ".complete";
+        std::size_t files = 0;
+        if (fs::exists(marker, ec)) {
+            for (fs::recursive_directory_iterator it(root, ec), end; it != end; it.increment(ec)) {
+                if (ec) break;
+                if (it->is_regular_file(ec)) ++files;
+            }
+            return files - 1;
+        }
+        fs::remove_all(root, ec);
+        fs::create_directories(root, ec);
+
+        static const char* decoyNames[] = { "preview.jpg", "README.txt", "thumb.png", "old.upk.bak", "notes.md" };
+        std::mt19937 rng(static_cast<unsigned>(spec.maps * 31 + spec.depth));
+        std::uniform_int_distribution<int> pct(0, 99);
+        for (int i = 0; i < spec.maps; ++i) {
+            const std::string id = std::to_string(2000000000 + i);
+            const std::string stem = "map_" + std::to_string(i);
+            fs::path mapDir;
+            if (i % 10 == 9) {
+                mapDir = root;
+            } else {
+                const fs::path item = root / id;
+                mapDir = item;
+                for (int d = 0; d < spec.depth; ++d) mapDir /= "lvl" + std::to_string(d);
+                fs::create_directories(mapDir, ec);
+                for (int k = 0; k < spec.decoys; ++k) {
+                    std::ofstream(item / decoyNames[k % 5], std::ios::binary) << "decoy";
+                    ++files;
+                }
+            }
+            std::ofstream(mapDir / (stem + ".upk"), std::ios::binary) << "UPK" << id;
+            ++files;
+            if (pct(rng) < spec.sidecarPct) {
+                std::ofstream(mapDir / (stem + ".json"), std::ios::binary)
+                    << "{\"publishedfileid\":\"" << id << "\",\"title\":\"Bench Map " << i << "\"}";
+                ++files;
+            }
+        }
+        std::ofstream(marker) << spec.tag();
+        return files;
+    }
+}
+
+int ss_bench::discovery(const std::vector<std::string>& args) {
+    std::vector<TreeSpec> specs;
+    if (args.size() > 1 && args[1] == "sweep") {
+        for (int maps : { 100, 1000, 10000, 50000 }) {
+            for (int depth : { 0, 3 }) {
+                TreeSpec t;
+                t.maps = maps;
+                t.depth = depth;
+                specs.push_back(t);
+            }
+        }
+    } else {
+        TreeSpec t;
+        try {
+            if (args.size() > 1) t.maps = std::clamp(std::stoi(args[1]), 1, 50000);
+            if (args.size() > 2) t.depth = std::clamp(std::stoi(args[2]), 0, 16);
+            if (args.size() > 3) t.sidecarPct = std::clamp(std::stoi(args[3]), 0, 100);
+            if (args.size() > 4) t.decoys = std::clamp(std::stoi(args[4]), 0, 5);
+        } catch (const std::exception&) {
+            std::fprintf(stderr, "discovery: arguments must be integers\n");
+            return 2;
+        }
+        specs.push_back(t);
+    }
+
+    // DiscoverWorkshopInDir and MirrorDirectory with default settings
+    // (dedup off); nothing here touches the plugin's data folder.
+    SuiteSpot plugin;
+
+    for (const auto& spec : specs) {
+        const fs::path tree = benchRoot() / "workshop" / spec.tag();
+        auto tGen = clock::now();
+        const std::size_t files = makeWorkshopTree(tree, spec);
+        const double genMs = msSince(tGen);
+
+        auto report = [&](const char* op, double ms, std::size_t found, std::uintmax_t bytes = 0) {
+            std::ostringstream js;
+            js << "{\"bench\":\"discovery\",\"op\":\"" << op << "\",\"tree\":\"" << spec.tag()
+               << "\",\"maps\":" << spec.maps << ",\"depth\":" << spec.depth
+               << ",\"sidecar_pct\":" << spec.sidecarPct << ",\"files\":" << files
+               << ",\"found\":" << found << ",\"ms\":" << ms
+               << ",\"files_per_s\":" << (ms > 0 ? files * 1000.0 / ms : 0.0)
+               << ",\"peak_rss_kb\":" << peakRssKb() << ",\"gen_ms\":" << genMs;
+            if (bytes) js << ",\"bytes\":" << bytes;
+            js << "}";
+            emit(js.str());
+        };
+
+        // LoadWorkshopMaps: the same index scan and catalog sort its
+        // background thread runs, against a bench-local index. Cold starts
+        // from an empty index, warm reuses the one cold just wrote.
+        {
+            const fs::path indexFile = benchRoot() / "workshop" / (spec.tag() + ".idx");
+            std::error_code ec;
+            fs::remove(indexFile, ec);
+            for (const char* op : { "load_workshop_maps_cold", "load_workshop_maps_warm" }) {
+                auto t0 = clock::now();
+                ss_index::WorkshopIndex index;
+                index.load(indexFile);
+                std::vector<WorkshopEntry> out;
+                index.scan({ tree }, out);
+                ss_catalog::assignKeys(out);
+                ss_catalog::sortEntries(out);
+                index.save();
+                report(op, msSince(t0), out.size());
+            }
+        }
+
+        {
+            std::vector<WorkshopEntry> found;
+            auto t0 = clock::now();
+            plugin.DiscoverWorkshopInDir(tree, found);
+            report("discover_workshop_in_dir", msSince(t0), found.size());
+        }
+
+        // Root detection, with the generated tree as the only candidate
+        // behind a few missing ones.
+        {
+            std::vector<fs::path> cands = {
+                benchRoot() / "missing_a", benchRoot() / "missing_b", tree
+            };
+            auto t0 = clock::now();
+            const fs::path root = ss_epic::detectWorkshopRoot(cands);
+            report("detect_workshop_root", msSince(t0), root.empty() ? 0 : 1);
+        }
+
+        // MirrorDirectory: cold into an empty target, then warm (nothing to copy).
+        {
+            const fs::path dst = benchRoot() / "mirror" / spec.tag();
+            std::error_code ec;
+            fs::remove_all(dst, ec);
+            for (const char* op : { "mirror_directory_cold", "mirror_directory_warm" }) {
+                auto t0 = clock::now();
+                auto st = plugin.MirrorDirectory(tree, dst);
+                report(op, msSince(t0), st.copied, st.bytesCopied);
+            }
+            fs::remove_all(dst, ec);
+        }
+
+        // Dedup mirror: the tree mirrored as two roots (think Epic and
+        // Steam) sharing one store. The second root should store ~0
+        // bytes; the warm pass should be served by the hash cache.
+        {
+            const fs::path base = benchRoot() / "mirror_dedup" / spec.tag();
+            std::error_code ec;
+            fs::remove_all(base, ec);
+            ss_mirror::Options opt;
+            opt.dedupStore = base / ".store";
+            const std::pair<const char*, const char*> runs[] = {
+                { "mirror_dedup_cold", "epic" }, { "mirror_dedup_second_root", "steam" }, { "mirror_dedup_warm", "epic" }
+            };
+            for (const auto& [op, name] : runs) {
+                auto t0 = clock::now();
+                auto st = ss_mirror::mirror(tree, base / name, opt);
+                const double ms = msSince(t0);
+                report(op, ms, st.linked + st.copied, st.bytesStored);
+                std::ostringstream js;
+                js << "{\"bench\":\"discovery\",\"op\":\"" << op << "_detail\",\"tree\":\"" << spec.tag()
+                   << "\",\"linked\":" << st.linked << ",\"copied\":" << st.copied
+                   << ",\"up_to_date\":" << st.upToDate << ",\"hashed\":" << st.hashed
+                   << ",\"hash_cache_hits\":" << st.hashCacheHits << ",\"bytes_stored\":" << st.bytesStored
+                   << ",\"failed\":" << st.failed << "}";
+                emit(js.str());
+            }
+            fs::remove_all(base, ec);
+        }
+    }
+    return 0;
+}
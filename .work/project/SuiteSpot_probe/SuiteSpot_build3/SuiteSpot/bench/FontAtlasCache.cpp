@@ -0,0 +1,246 @@
+// FontAtlasCache.cpp
+//
+// Restoring replays the parts of ImFontAtlasBuildWithStbTruetype that are
+// not rasterizing or packing: register the default custom rect, set each
+// font up from its configs, then install the cached glyphs, rect
+// positions and texture and build the lookup tables. Glyphs are stored
+// field by field (not as raw structs) so the file does not depend on
+// struct layout.
+
+#include "pch.h"
+#include "FontAtlasCache.h"
+#include "ContentHash.h"
+#include "MappedFile.h"
+#include "IMGUI/imgui_internal.h"
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace ss_font {
+
+    namespace {
+        constexpr char kMagic[4] = { 'S', 'S', 'F', 'A' };
+        constexpr std::uint16_t kVersion = 1;
+        constexpr std::size_t kHeaderBytes = 24;
+        constexpr int kMaxTexSide = 1 << 15;
+
+        template <typename T>
+        void writeLE(std::string& out, T v) { out.append(reinterpret_cast<const char*>(&v), sizeof(T)); }
+
+        // Bounds-checked reads over the payload; a short read clears ok.
+        struct Reader {
+            const char* p;
+            const char* end;
+            bool ok = true;
+
+            template <typename T>
+            T get() {
+                T v{};
+                if (static_cast<std::size_t>(end - p) < sizeof(T)) { ok = false; p = end; return v; }
+                std::memcpy(&v, p, sizeof(T));
+                p += sizeof(T);
+                return v;
+            }
+        };
+
+        int fontIndex(const ImFontAtlas& atlas, const ImFont* font) {
+            for (int i = 0; i < atlas.Fonts.Size; ++i)
+                if (atlas.Fonts[i] == font) return i;
+            return -1;
+        }
+
+        struct CachedFont {
+            float ascent = 0, descent = 0;
+            int metricsTotalSurface = 0;
+            ImWchar ellipsisChar = 0;
+            std::vector<ImFontGlyph> glyphs;
+        };
+    }
+
+    std::uint64_t inputKey(const ImFontAtlas& atlas) {
+        std::string in;
+        writeLE<std::int32_t>(in, IMGUI_VERSION_NUM);
+        writeLE<std::uint16_t>(in, kVersion);
+        writeLE<std::int32_t>(in, atlas.Flags);
+        writeLE<std::int32_t>(in, atlas.TexDesiredWidth);
+        writeLE<std::int32_t>(in, atlas.TexGlyphPadding);
+        writeLE<std::int32_t>(in, atlas.Fonts.Size);
+
+        for (const ImFontConfig& cfg : atlas.ConfigData) {
+            writeLE<std::uint64_t>(in, ss_hash::hash64(cfg.FontData, static_cast<std::size_t>(cfg.FontDataSize)));
+            writeLE<std::int32_t>(in, cfg.FontDataSize);
+            writeLE<std::int32_t>(in, cfg.FontNo);
+            writeLE<float>(in, cfg.SizePixels);
+            writeLE<std::int32_t>(in, cfg.OversampleH);
+            writeLE<std::int32_t>(in, cfg.OversampleV);
+            writeLE<std::uint8_t>(in, cfg.PixelSnapH);
+            writeLE<float>(in, cfg.GlyphExtraSpacing.x);
+            writeLE<float>(in, cfg.GlyphExtraSpacing.y);
+            writeLE<float>(in, cfg.GlyphOffset.x);
+            writeLE<float>(in, cfg.GlyphOffset.y);
+            writeLE<float>(in, cfg.GlyphMinAdvanceX);
+            writeLE<float>(in, cfg.GlyphMaxAdvanceX);
+            writeLE<std::uint8_t>(in, cfg.MergeMode);
+            writeLE<std::uint32_t>(in, cfg.RasterizerFlags);
+            writeLE<float>(in, cfg.RasterizerMultiply);
+            writeLE<ImWchar>(in, cfg.EllipsisChar);
+            writeLE<std::int32_t>(in, fontIndex(atlas, cfg.DstFont));
+            // The builder falls back to the default ranges, so hash those.
+            const ImWchar* ranges = cfg.GlyphRanges ? cfg.GlyphRanges : const_cast<ImFontAtlas&>(atlas).GetGlyphRangesDefault();
+            for (; ranges[0] && ranges[1]; ranges += 2) {
+                writeLE<ImWchar>(in, ranges[0]);
+                writeLE<ImWchar>(in, ranges[1]);
+            }
+            writeLE<ImWchar>(in, 0);
+        }
+        for (const ImFontAtlasCustomRect& r : atlas.CustomRects) {
+            writeLE<std::uint32_t>(in, r.ID);
+            writeLE<std::uint16_t>(in, r.Width);
+            writeLE<std::uint16_t>(in, r.Height);
+            writeLE<float>(in, r.GlyphAdvanceX);
+            writeLE<float>(in, r.GlyphOffset.x);
+            writeLE<float>(in, r.GlyphOffset.y);
+            writeLE<std::int32_t>(in, fontIndex(atlas, r.Font));
+        }
+        return ss_hash::hash64(in.data(), in.size());
+    }
+
+    bool save(const ImFontAtlas& atlas, const fs::path& cacheFile, std::uint64_t key) {
+        if (!atlas.TexPixelsAlpha8 || atlas.TexWidth <= 0 || atlas.TexHeight <= 0) return false;
+
+        std::string payload;
+        writeLE<std::int32_t>(payload, atlas.TexWidth);
+        writeLE<std::int32_t>(payload, atlas.TexHeight);
+        writeLE<float>(payload, atlas.TexUvWhitePixel.x);
+        writeLE<float>(payload, atlas.TexUvWhitePixel.y);
+        writeLE<std::uint32_t>(payload, static_cast<std::uint32_t>(atlas.CustomRects.Size));
+        for (const ImFontAtlasCustomRect& r : atlas.CustomRects) {
+            writeLE<std::uint16_t>(payload, r.X);
+            writeLE<std::uint16_t>(payload, r.Y);
+        }
+        writeLE<std::uint32_t>(payload, static_cast<std::uint32_t>(atlas.Fonts.Size));
+        for (const ImFont* font : atlas.Fonts) {
+            writeLE<float>(payload, font->Ascent);
+            writeLE<float>(payload, font->Descent);
+            writeLE<std::int32_t>(payload, font->MetricsTotalSurface);
+            writeLE<ImWchar>(payload, font->EllipsisChar);
+            writeLE<std::uint32_t>(payload, static_cast<std::uint32_t>(font->Glyphs.Size));
+            for (const ImFontGlyph& g : font->Glyphs) {
+                writeLE<ImWchar>(payload, g.Codepoint);
+                for (float f : { g.AdvanceX, g.X0, g.Y0, g.X1, g.Y1, g.U0, g.V0, g.U1, g.V1 }) writeLE<float>(payload, f);
+            }
+        }
+        payload.append(reinterpret_cast<const char*>(atlas.TexPixelsAlpha8),
+                       static_cast<std::size_t>(atlas.TexWidth) * static_cast<std::size_t>(atlas.TexHeight));
+
+        std::string header(kMagic, sizeof(kMagic));
+        writeLE<std::uint16_t>(header, kVersion);
+        writeLE<std::uint16_t>(header, 0);
+        writeLE<std::uint64_t>(header, key);
+        writeLE<std::uint32_t>(header, static_cast<std::uint32_t>(payload.size()));
+        writeLE<std::uint32_t>(header, static_cast<std::uint32_t>(ss_hash::hash64(payload.data(), payload.size())));
+
+        std::error_code ec;
+        fs::create_directories(cacheFile.parent_path(), ec);
+        auto tmp = cacheFile;
+        tmp += ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) return false;
+            out.write(header.data(), static_cast<std::streamsize>(header.size()));
+            out.write(payload.data(), static_cast<std::streamsize>(payload.size()));
+            if (!out) { out.close(); fs::remove(tmp, ec); return false; }
+        }
+        fs::rename(tmp, cacheFile, ec);
+        if (ec) { fs::remove(tmp, ec); return false; }
+        return true;
+    }
+
+    bool load(ImFontAtlas& atlas, const fs::path& cacheFile, std::uint64_t key) {
+        ss_io::MappedFile map;
+        if (!map.open(cacheFile) || map.size() < kHeaderBytes) return false;
+        const char* p = map.data();
+        Reader head{ p + sizeof(kMagic), p + kHeaderBytes };
+        if (std::memcmp(p, kMagic, sizeof(kMagic)) != 0 || head.get<std::uint16_t>() != kVersion) return false;
+        head.get<std::uint16_t>();
+        if (head.get<std::uint64_t>() != key) return false;
+        const std::uint32_t len = head.get<std::uint32_t>();
+        const std::uint32_t sum = head.get<std::uint32_t>();
+        if (map.size() - kHeaderBytes != len ||
+            static_cast<std::uint32_t>(ss_hash::hash64(p + kHeaderBytes, len)) != sum) return false;
+
+        // Parse everything before touching the atlas.
+        Reader in{ p + kHeaderBytes, p + kHeaderBytes + len };
+        const int texW = in.get<std::int32_t>();
+        const int texH = in.get<std::int32_t>();
+        ImVec2 white;
+        white.x = in.get<float>();
+        white.y = in.get<float>();
+        if (texW <= 0 || texH <= 0 || texW > kMaxTexSide || texH > kMaxTexSide) return false;
+
+        const std::uint32_t rectCount = in.get<std::uint32_t>();
+        if (!in.ok || rectCount > static_cast<std::size_t>(in.end - in.p) / 4) return false;
+        std::vector<std::pair<unsigned short, unsigned short>> rects(rectCount);
+        for (auto& r : rects) { r.first = in.get<std::uint16_t>(); r.second = in.get<std::uint16_t>(); }
+
+        const std::uint32_t fontCount = in.get<std::uint32_t>();
+        if (!in.ok || fontCount != static_cast<std::uint32_t>(atlas.Fonts.Size)) return false;
+        std::vector<CachedFont> fonts(fontCount);
+        for (CachedFont& f : fonts) {
+            f.ascent = in.get<float>();
+            f.descent = in.get<float>();
+            f.metricsTotalSurface = in.get<std::int32_t>();
+            f.ellipsisChar = in.get<ImWchar>();
+            const std::uint32_t glyphs = in.get<std::uint32_t>();
+            if (!in.ok || glyphs >= 0xFFFF) return false;
+            f.glyphs.resize(glyphs);
+            for (ImFontGlyph& g : f.glyphs) {
+                g.Codepoint = in.get<ImWchar>();
+                for (float* v : { &g.AdvanceX, &g.X0, &g.Y0, &g.X1, &g.Y1, &g.U0, &g.V0, &g.U1, &g.V1 }) *v = in.get<float>();
+            }
+        }
+        const std::size_t texBytes = static_cast<std::size_t>(texW) * static_cast<std::size_t>(texH);
+        if (!in.ok || static_cast<std::size_t>(in.end - in.p) != texBytes) return false;
+
+        ImFontAtlasBuildRegisterDefaultCustomRects(&atlas);
+        if (rects.size() != static_cast<std::size_t>(atlas.CustomRects.Size)) return false;
+
+        atlas.TexID = (ImTextureID)NULL;
+        atlas.ClearTexData();
+        atlas.TexWidth = texW;
+        atlas.TexHeight = texH;
+        atlas.TexUvScale = ImVec2(1.0f / texW, 1.0f / texH);
+        atlas.TexUvWhitePixel = white;
+        atlas.TexPixelsAlpha8 = static_cast<unsigned char*>(IM_ALLOC(texBytes));
+        std::memcpy(atlas.TexPixelsAlpha8, in.p, texBytes);
+        for (std::size_t i = 0; i < rects.size(); ++i) {
+            atlas.CustomRects[static_cast<int>(i)].X = rects[i].first;
+            atlas.CustomRects[static_cast<int>(i)].Y = rects[i].second;
+        }
+
+        for (ImFont* font : atlas.Fonts) font->ConfigDataCount = 0;
+        for (ImFontConfig& cfg : atlas.ConfigData) ImFontAtlasBuildSetupFont(&atlas, cfg.DstFont, &cfg, 0.0f, 0.0f);
+        for (int i = 0; i < atlas.Fonts.Size; ++i) {
+            ImFont* font = atlas.Fonts[i];
+            CachedFont& c = fonts[static_cast<std::size_t>(i)];
+            font->Ascent = c.ascent;
+            font->Descent = c.descent;
+            font->MetricsTotalSurface = c.metricsTotalSurface;
+            font->EllipsisChar = c.ellipsisChar;
+            font->Glyphs.resize(static_cast<int>(c.glyphs.size()));
+            if (!c.glyphs.empty()) std::memcpy(font->Glyphs.Data, c.glyphs.data(), c.glyphs.size() * sizeof(ImFontGlyph));
+            font->BuildLookupTable();
+        }
+        return true;
+    }
+
+    CacheResult build(ImFontAtlas& atlas, const fs::path& cacheFile) {
+        if (atlas.ConfigData.empty()) atlas.AddFontDefault();
+        const std::uint64_t key = inputKey(atlas);
+        if (!cacheFile.empty() && load(atlas, cacheFile, key)) return CacheResult::Loaded;
+        if (!atlas.Build()) return CacheResult::Failed;
+        if (cacheFile.empty() || !save(atlas, cacheFile, key)) return CacheResult::BuiltNotSaved;
+        return CacheResult::Built;
+    }
+}
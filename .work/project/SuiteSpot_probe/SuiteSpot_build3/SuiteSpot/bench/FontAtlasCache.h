@@ -0,0 +1,46 @@
+// FontAtlasCache.h
+//
+// Disk cache for baked ImGui font atlases. ImFontAtlas::Build rasterizes
+// every glyph of every font/size with stb_truetype and packs them with
+// stb_rectpack, which gets slow as glyph ranges and sizes grow. The cache
+// stores what the build produces (the alpha texture, each font's glyph
+// table and metrics, and where the custom rects were packed) so a later
+// run with the same inputs only reads a file.
+//
+// The cache is keyed by a hash of everything that affects the bake: the
+// font file bytes, each ImFontConfig's size, oversampling, ranges and
+// spacing, the atlas flags and padding, the custom rects, and the ImGui
+// version. A key mismatch, a format version change or a damaged file
+// just means a normal build (and a fresh cache file).
+//
+// Layout: "SSFA", u16 version, u16 reserved, u64 key, u32 payload bytes,
+// u32 checksum (low half of xxHash64 of the payload), then the payload.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+
+struct ImFontAtlas;
+
+namespace ss_font {
+    namespace fs = std::filesystem;
+
+    enum class CacheResult { Loaded, Built, BuiltNotSaved, Failed };
+
+    // Bakes `atlas`, whose fonts have been added (AddFont*) but not built.
+    // Loads `cacheFile` when it matches the atlas' inputs; otherwise builds
+    // and rewrites it. With no fonts added, the default font is used, as
+    // GetTexDataAsAlpha8 would. An empty path disables the cache.
+    CacheResult build(ImFontAtlas& atlas, const fs::path& cacheFile);
+
+    // Hash of the atlas' build inputs; the cache key.
+    std::uint64_t inputKey(const ImFontAtlas& atlas);
+
+    // Restores a bake saved under `key`. Leaves the atlas untouched and
+    // returns false if the file is missing, stale or damaged.
+    bool load(ImFontAtlas& atlas, const fs::path& cacheFile, std::uint64_t key);
+
+    // Writes a built atlas (atomically, via a temporary file).
+    bool save(const ImFontAtlas& atlas, const fs::path& cacheFile, std::uint64_t key);
+}
@@ -0,0 +1,100 @@
+// FontsBench.cpp
+//
+//   suitespot_bench fonts [px...]
+//
+// Bakes a font atlas with Latin and Cyrillic ranges at each pixel size
+// (default 13 16 20 24), from Segoe UI when it is installed and the
+// built-in font otherwise: once with ImFontAtlas::Build, once restored
+// from the disk cache, and checks that both give the same atlas.
+
+#include "pch.h"
+#include "Bench.h"
+#include "FontAtlasCache.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+
+int ss_bench::fonts(const std::vector<std::string>& args) {
+    namespace fs = std::filesystem;
+    std::vector<float> sizes;
+    try {
+        for (std::size_t i = 1; i < args.size(); ++i) sizes.push_back(std::clamp(std::stof(args[i]), 6.0f, 96.0f));
+    } catch (const std::exception&) {
+        std::fprintf(stderr, "fonts: sizes must be numbers\n");
+        return 2;
+    }
+    if (sizes.empty()) sizes = { 13.0f, 16.0f, 20.0f, 24.0f };
+
+    fs::path ttf;
+    if (const char* windir = std::getenv("WINDIR")) ttf = fs::path(windir) / "Fonts" / "segoeui.ttf";
+    std::error_code ec;
+    if (!ttf.empty() && !fs::exists(ttf, ec)) ttf.clear();
+    auto addFonts = [&](ImFontAtlas& atlas) {
+        for (float px : sizes) {
+            if (ttf.empty()) {
+                ImFontConfig cfg;
+                cfg.SizePixels = px;
+                cfg.GlyphRanges = atlas.GetGlyphRangesCyrillic();
+                atlas.AddFontDefault(&cfg);
+            } else {
+                atlas.AddFontFromFileTTF(ttf.string().c_str(), px, nullptr, atlas.GetGlyphRangesCyrillic());
+            }
+        }
+    };
+    const fs::path cache = benchRoot() / "fonts.atlas";
+    fs::create_directories(benchRoot(), ec);
+    fs::remove(cache, ec);
+
+    double buildMs = 0, loadMs = 0;
+    ss_font::CacheResult built = ss_font::CacheResult::Failed, loaded = ss_font::CacheResult::Failed;
+    ImFontAtlas cold, warm;
+    for (int pass = 0; pass < 3; ++pass) {
+        cold.Clear();
+        addFonts(cold);
+        auto t0 = clock::now();
+        built = ss_font::build(cold, cache);
+        double ms = msSince(t0);
+        if (pass == 0 || ms < buildMs) buildMs = ms;
+        fs::remove(cache, ec);
+    }
+    ss_font::save(cold, cache, ss_font::inputKey(cold));
+    for (int pass = 0; pass < 3; ++pass) {
+        warm.Clear();
+        addFonts(warm);
+        auto t0 = clock::now();
+        loaded = ss_font::build(warm, cache);
+        double ms = msSince(t0);
+        if (pass == 0 || ms < loadMs) loadMs = ms;
+    }
+
+    int glyphs = 0;
+    bool same = cold.TexWidth == warm.TexWidth && cold.TexHeight == warm.TexHeight && cold.Fonts.Size == warm.Fonts.Size &&
+                cold.TexPixelsAlpha8 && warm.TexPixelsAlpha8 &&
+                std::memcmp(cold.TexPixelsAlpha8, warm.TexPixelsAlpha8, static_cast<std::size_t>(cold.TexWidth) * cold.TexHeight) == 0;
+    for (int i = 0; same && i < cold.Fonts.Size; ++i) {
+        const ImFont& a = *cold.Fonts[i];
+        const ImFont& b = *warm.Fonts[i];
+        glyphs += a.Glyphs.Size;
+        same = a.Glyphs.Size == b.Glyphs.Size && a.IndexLookup.Size == b.IndexLookup.Size &&
+               a.FontSize == b.FontSize && a.Ascent == b.Ascent && a.Descent == b.Descent &&
+               a.FallbackAdvanceX == b.FallbackAdvanceX;
+        for (int g = 0; same && g < a.Glyphs.Size; ++g) {
+            const ImFontGlyph& x = a.Glyphs[g];
+            const ImFontGlyph& y = b.Glyphs[g];
+            same = x.Codepoint == y.Codepoint && x.AdvanceX == y.AdvanceX && x.X0 == y.X0 && x.Y0 == y.Y0 &&
+                   x.X1 == y.X1 && x.Y1 == y.Y1 && x.U0 == y.U0 && x.V0 == y.V0 && x.U1 == y.U1 && x.V1 == y.V1;
+        }
+    }
+
+    std::ostringstream js;
+    js << "{\"bench\":\"fonts\",\"font\":\"" << (ttf.empty() ? "default" : "segoeui") << "\",\"sizes\":" << sizes.size()
+       << ",\"glyphs\":" << glyphs << ",\"tex\":\"" << cold.TexWidth << "x" << cold.TexHeight
+       << "\",\"cache_bytes\":" << fs::file_size(cache, ec) << ",\"build_ms\":" << buildMs << ",\"cached_ms\":" << loadMs
+       << ",\"cache_hit\":" << (loaded == ss_font::CacheResult::Loaded ? "true" : "false")
+       << ",\"built\":" << (built != ss_font::CacheResult::Failed ? "true" : "false")
+       << ",\"identical\":" << (same ? "true" : "false") << "}";
+    emit(js.str());
+    return 0;
+}
@@ -0,0 +1,78 @@
+// FuzzyBench.cpp
+//
+//   suitespot_bench fuzzy [names]
+//
+// Times fuzzy ranking of generated map names (default 50k) for a few
+// typical queries: scoring every name and sorting, against the index's
+// SSE2 prefilter plus top-k heap.
+
+#include "pch.h"
+#include "Bench.h"
+#include "FuzzyMatch.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <sstream>
+
+int ss_bench::fuzzy(const std::vector<std::string>& args) {
+    int count = 50000;
+    try {
+        if (args.size() > 1) count = std::clamp(std::stoi(args[1]), 1, 2000000);
+    } catch (const std::exception&) {
+        std::fprintf(stderr, "fuzzy: argument must be an integer\n");
+        return 2;
+    }
+    constexpr std::size_t kTop = 50;
+    const std::vector<std::string> names = makeMapNames(count);
+    const char* const queries[] = { "dfh snw", "s", "lthmyr rings", "mannfield night 12", "qxz" };
+
+    auto t0 = clock::now();
+    ss_search::FuzzyIndex index;
+    index.reserve(names.size(), names.size() * 24);
+    for (std::size_t i = 0; i < names.size(); ++i) index.add(0, static_cast<std::uint32_t>(i), names[i]);
+    const double buildMs = msSince(t0);
+
+    for (const char* query : queries) {
+        // Terms as rank() splits them, for the exhaustive baseline.
+        std::vector<std::string> terms;
+        std::istringstream words(query);
+        for (std::string w; words >> w;) {
+            for (auto& c : w) c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            terms.push_back(w);
+        }
+
+        double naive = 0, ranked = 0;
+        std::size_t matches = 0, hits = 0;
+        for (int pass = 0; pass < 3; ++pass) {
+            t0 = clock::now();
+            std::vector<std::pair<int, std::uint32_t>> all;
+            for (std::size_t i = 0; i < names.size(); ++i) {
+                int total = 0;
+                for (const auto& t : terms) {
+                    const int s = ss_search::FuzzyIndex::scoreTerm(names[i], t);
+                    if (s < 0) { total = -1; break; }
+                    total += s;
+                }
+                if (total >= 0) all.push_back({ -total, static_cast<std::uint32_t>(i) });
+            }
+            std::sort(all.begin(), all.end());
+            double ms = msSince(t0);
+            if (pass == 0 || ms < naive) naive = ms;
+            matches = all.size();
+
+            std::vector<ss_search::FuzzyIndex::Hit> out;
+            t0 = clock::now();
+            index.rank(query, kTop, out);
+            ms = msSince(t0);
+            if (pass == 0 || ms < ranked) ranked = ms;
+            hits = out.size();
+        }
+
+        std::ostringstream js;
+        js << "{\"bench\":\"fuzzy\",\"names\":" << names.size() << ",\"query\":\"" << query
+           << "\",\"matches\":" << matches << ",\"top\":" << hits << ",\"build_ms\":" << buildMs
+           << ",\"score_all_sort_ms\":" << naive << ",\"prefilter_topk_ms\":" << ranked << "}";
+        emit(js.str());
+    }
+    return 0;
+}
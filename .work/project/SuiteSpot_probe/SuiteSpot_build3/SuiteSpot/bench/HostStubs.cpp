@@ -0,0 +1,96 @@
+// HostStubs.cpp
+//
+// In-process stand-ins for the BakkesMod host: CVars are named string
+// values, notifiers are stored and only run through executeCommand, and the
+// game never raises an event. Log lines go to stderr so the benchmark's
+// own output on stdout stays machine-readable.
+
+#include "bakkesmod/plugin/bakkesmodplugin.h"
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+#include <unordered_map>
+
+struct CVarWrapper::State {
+    std::string value;
+    std::vector<std::function<void(std::string, CVarWrapper)>> onChanged;
+};
+
+bool CVarWrapper::getBoolValue() const { return getIntValue() != 0; }
+int CVarWrapper::getIntValue() const { return state_ ? std::atoi(state_->value.c_str()) : 0; }
+float CVarWrapper::getFloatValue() const { return state_ ? std::strtof(state_->value.c_str(), nullptr) : 0.0f; }
+std::string CVarWrapper::getStringValue() const { return state_ ? state_->value : std::string(); }
+
+void CVarWrapper::setValue(std::string value) {
+    if (!state_ || state_->value == value) return;
+    std::string old = std::move(state_->value);
+    state_->value = std::move(value);
+    // Callbacks may set the value again; iterate over a copy.
+    const auto callbacks = state_->onChanged;
+    for (const auto& cb : callbacks) cb(old, *this);
+}
+void CVarWrapper::setValue(int value) { setValue(std::to_string(value)); }
+void CVarWrapper::setValue(float value) {
+    std::ostringstream os;
+    os << value;
+    setValue(os.str());
+}
+
+void CVarWrapper::addOnValueChanged(std::function<void(std::string, CVarWrapper)> callback) {
+    if (state_) state_->onChanged.push_back(std::move(callback));
+}
+
+struct CVarManagerWrapper::Impl {
+    std::unordered_map<std::string, std::shared_ptr<CVarWrapper::State>> cvars;
+    std::unordered_map<std::string, std::function<void(std::vector<std::string>)>> notifiers;
+};
+
+CVarManagerWrapper::CVarManagerWrapper() : impl_(std::make_unique<Impl>()) {}
+CVarManagerWrapper::~CVarManagerWrapper() = default;
+
+void CVarManagerWrapper::log(std::string text) { std::fprintf(stderr, "%s\n", text.c_str()); }
+void CVarManagerWrapper::log(std::wstring text) { std::fprintf(stderr, "%ls\n", text.c_str()); }
+
+CVarWrapper CVarManagerWrapper::registerCvar(std::string cvar, std::string defaultValue, std::string, bool, bool, float,
+                                             bool, float, bool) {
+    auto& state = impl_->cvars[cvar];
+    if (!state) {
+        state = std::make_shared<CVarWrapper::State>();
+        state->value = std::move(defaultValue);
+    }
+    return CVarWrapper(state);
+}
+
+bool CVarManagerWrapper::removeCvar(std::string cvar) { return impl_->cvars.erase(cvar) != 0; }
+
+CVarWrapper CVarManagerWrapper::getCvar(std::string cvar) {
+    auto it = impl_->cvars.find(cvar);
+    return it == impl_->cvars.end() ? CVarWrapper() : CVarWrapper(it->second);
+}
+
+void CVarManagerWrapper::registerNotifier(std::string cvar, std::function<void(std::vector<std::string>)> notifier,
+                                          std::string, unsigned char) {
+    impl_->notifiers[cvar] = std::move(notifier);
+}
+
+bool CVarManagerWrapper::removeNotifier(std::string cvar) { return impl_->notifiers.erase(cvar) != 0; }
+
+// Runs a registered notifier with whitespace-separated arguments; anything
+// else would have gone to the game and is only logged.
+void CVarManagerWrapper::executeCommand(std::string command, bool log) {
+    std::istringstream in(command);
+    std::vector<std::string> args;
+    for (std::string word; in >> word;) args.push_back(std::move(word));
+    if (args.empty()) return;
+    auto it = impl_->notifiers.find(args[0]);
+    if (it != impl_->notifiers.end()) {
+        it->second(args);
+    } else if (log) {
+        this->log("[host] " + command);
+    }
+}
+
+void GameWrapper::HookEvent(std::string, std::function<void(std::string)>) {}
+void GameWrapper::UnhookEvent(std::string) {}
+void GameWrapper::SetTimeout(std::function<void(GameWrapper*)>, float) {}
+void GameWrapper::Execute(std::function<void(GameWrapper*)>) {}
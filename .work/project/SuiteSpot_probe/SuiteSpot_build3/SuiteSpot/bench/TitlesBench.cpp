@@ -0,0 +1,86 @@
+// TitlesBench.cpp
+//
+//   suitespot_bench titles [dir]
+//
+// Times sidecar title extraction over every .json under `dir` (default: a
+// generated corpus of 2000 Steam-sized files), best of three passes.
+
+#include "pch.h"
+#include "Bench.h"
+#include "JsonTitle.h"
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    // Writes `count` sidecar files shaped like Steam workshop metadata: a
+    // nested author object carrying its own "title" and a long escaped
+    // description. The real top-level title comes before the description
+    // in half the files and after it in the other half.
+    void makeJsonCorpus(const fs::path& dir, int count) {
+        std::error_code ec;
+        fs::create_directories(dir, ec);
+        std::mt19937 rng(1234);
+        std::uniform_int_distribution<int> descLen(4 * 1024, 96 * 1024);
+        for (int i = 0; i < count; ++i) {
+            auto file = dir / ("map" + std::to_string(i) + ".json");
+            if (fs::exists(file, ec)) continue;
+            std::ofstream out(file.string(), std::ios::binary | std::ios::trunc);
+            out << "{\n  \"publishedfileid\": \"" << (2000000000 + i) << "\",\n"
+                << "  \"author\": { \"title\": \"Creator " << i << "\", \"tags\": [\"a\", \"b\"] },\n";
+            const bool titleFirst = (i % 2) == 0;
+            if (titleFirst) out << "  \"title\": \"Synthetic Map " << i << " \\u2013 \\ud83d\\ude80\",\n";
+            out << "  \"description\": \"";
+            int n = descLen(rng);
+            for (int k = 0; k < n; ++k) out << ((k % 97 == 0) ? "\\n" : (k % 89 == 0) ? "\\\"" : "x");
+            out << "\"";
+            if (!titleFirst) out << ",\n  \"title\": \"Synthetic Map " << i << " \\u2013 \\ud83d\\ude80\"";
+            out << "\n}\n";
+        }
+    }
+}
+
+int ss_bench::titles(const std::vector<std::string>& args) {
+    fs::path dir = args.size() > 1 ? fs::path(args[1]) : benchRoot() / "titles";
+    if (args.size() <= 1) makeJsonCorpus(dir, 2000);
+
+    std::vector<fs::path> corpus;
+    std::uintmax_t totalBytes = 0;
+    std::error_code ec;
+    for (fs::recursive_directory_iterator it(dir, ec), end; it != end; it.increment(ec)) {
+        if (ec) break;
+        if (it->is_regular_file(ec) && it->path().extension() == ".json") {
+            corpus.push_back(it->path());
+            totalBytes += it->file_size(ec);
+        }
+    }
+    if (corpus.empty()) {
+        std::fprintf(stderr, "titles: no .json files under %s\n", dir.string().c_str());
+        return 1;
+    }
+
+    double best = 0;
+    std::size_t bytesRead = 0, found = 0;
+    for (int pass = 0; pass < 3; ++pass) {
+        bytesRead = found = 0;
+        auto t0 = clock::now();
+        for (const auto& p : corpus) {
+            auto r = ss_json::findTopLevelString(p, "title");
+            bytesRead += r.bytesRead;
+            found += r.found ? 1 : 0;
+        }
+        double ms = msSince(t0);
+        if (pass == 0 || ms < best) best = ms;
+    }
+
+    std::ostringstream js;
+    js << "{\"bench\":\"titles\",\"files\":" << corpus.size()
+       << ",\"bytes_total\":" << totalBytes << ",\"bytes_read\":" << bytesRead
+       << ",\"found\":" << found << ",\"ms\":" << best
+       << ",\"us_per_file\":" << (best * 1000.0 / corpus.size()) << "}";
+    emit(js.str());
+    return 0;
+}
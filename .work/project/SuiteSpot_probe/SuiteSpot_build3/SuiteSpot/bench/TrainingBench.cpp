@@ -0,0 +1,107 @@
+// TrainingBench.cpp
+//
+//   suitespot_bench training [lines]
+//
+// Times LoadTrainingMaps' parser on a generated library (default 100k
+// lines) against the getline/substr loop it replaced, plus the writer.
+
+#include "pch.h"
+#include "Bench.h"
+#include "MapList.h"
+#include "TrainingCsv.h"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+namespace {
+    namespace fs = std::filesystem;
+
+    // Writes a training library of `lines` lines shaped like a large user
+    // collection: pack codes in the usual XXXX-XXXX-XXXX-XXXX form, every
+    // 50th name quoted with a comma inside, every 200th line repeating an
+    // earlier code and every 500th line malformed. Reused if present.
+    fs::path makeTrainingCsv(int lines) {
+        const fs::path file = ss_bench::benchRoot() / ("training_" + std::to_string(lines) + ".txt");
+        std::error_code ec;
+        if (fs::exists(file, ec)) return file;
+        fs::create_directories(file.parent_path(), ec);
+        std::ofstream out(file.string(), std::ios::binary | std::ios::trunc);
+        char code[20];
+        auto codeFor = [&](unsigned v) {
+            std::snprintf(code, sizeof(code), "%04X-%04X-%04X-%04X",
+                          (v * 2654435761u) >> 16, v & 0xFFFF, (v * 40503u) & 0xFFFF, (v ^ 0xA5A5u) & 0xFFFF);
+            return code;
+        };
+        for (int i = 0; i < lines; ++i) {
+            if (i % 500 == 499) { out << "not a valid line\n"; continue; }
+            out << codeFor(static_cast<unsigned>(i % 200 == 199 ? i / 2 : i)) << ',';
+            if (i % 50 == 0) out << "\"Pack " << i << ", shooting\"\n";
+            else out << "Pack " << i << " - Aerials & Redirects\n";
+        }
+        return file;
+    }
+}
+
+int ss_bench::training(const std::vector<std::string>& args) {
+    int lines = 100000;
+    try {
+        if (args.size() > 1) lines = std::clamp(std::stoi(args[1]), 1, 5000000);
+    } catch (const std::exception&) {
+        std::fprintf(stderr, "training: argument must be an integer\n");
+        return 2;
+    }
+    const fs::path file = makeTrainingCsv(lines);
+    std::error_code ec;
+    const auto bytes = fs::file_size(file, ec);
+
+    auto report = [&](const char* op, double ms, std::size_t entries, std::size_t issues) {
+        std::ostringstream js;
+        js << "{\"bench\":\"training\",\"op\":\"" << op << "\",\"lines\":" << lines
+           << ",\"bytes\":" << bytes << ",\"entries\":" << entries << ",\"issues\":" << issues
+           << ",\"ms\":" << ms << ",\"ns_per_line\":" << (ms * 1e6 / lines)
+           << ",\"peak_rss_kb\":" << peakRssKb() << "}";
+        emit(js.str());
+    };
+
+    // Best of three for each; the file is in the page cache after the first.
+    double best = 0;
+    std::size_t found = 0;
+    for (int pass = 0; pass < 3; ++pass) {
+        auto t0 = clock::now();
+        std::vector<TrainingEntry> out;
+        std::ifstream in(file.string());
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.empty()) continue;
+            auto pos = line.find(',');
+            if (pos == std::string::npos) continue;
+            std::string code = line.substr(0, pos);
+            std::string name = line.substr(pos + 1);
+            if (!code.empty() && !name.empty()) out.push_back({ code, name });
+        }
+        const double ms = msSince(t0);
+        if (pass == 0 || ms < best) best = ms;
+        found = out.size();
+    }
+    report("getline_substr", best, found, 0);
+
+    ss_training::ParseResult parsed;
+    for (int pass = 0; pass < 3; ++pass) {
+        auto t0 = clock::now();
+        ss_training::load(file, parsed);
+        const double ms = msSince(t0);
+        if (pass == 0 || ms < best) best = ms;
+    }
+    report("mmap_parse", best, parsed.entries.size(), parsed.issues.size());
+
+    for (int pass = 0; pass < 3; ++pass) {
+        auto t0 = clock::now();
+        const std::string text = ss_training::serialize(parsed.entries);
+        const double ms = msSince(t0);
+        if (pass == 0 || ms < best) best = ms;
+        found = text.size();
+    }
+    report("serialize", best, parsed.entries.size(), 0);
+    return 0;
+}
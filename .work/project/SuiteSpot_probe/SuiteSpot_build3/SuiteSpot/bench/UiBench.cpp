@@ -0,0 +1,194 @@
+// UiBench.cpp
+//
+// Headless frame benchmark for the SuiteSpot settings page. Renders
+// SuiteSpot::RenderSettings into an ImGui context with no renderer behind
+// it, against the stub host in HostStubs.cpp, so it runs without the game
+// or a GPU.
+//
+//   suitespot_ui_bench [frames] [size...]
+//
+// For each size (default 1000 10000 100000) the training and workshop
+// lists are filled with that many generated maps, and every map type is
+// rendered for `frames` frames (default 2000) with its picker closed and
+// open. Each scenario prints one JSON line on stdout:
+//   - first-frame and steady per-frame CPU time, plus the worst frame
+//   - heap allocations per frame on the render thread (operator new and
+//     ImGui's allocator), and ImGui's share of them
+//   - vertex, index and draw-command counts from ImDrawData
+//
+// The map lists are this process' own; nothing else runs against them.
+// Plugin files (settings, the font atlas cache) go under
+// %TEMP%/suitespot_ui_bench instead of the real BakkesMod data folder.
+
+#include "pch.h"
+#include "Bench.h"
+#include "SuiteSpot.h"
+#include "FontAtlasCache.h"
+#include "WorkshopCatalog.h"
+#include "IMGUI/imgui_internal.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <sstream>
+
+namespace {
+    namespace fs = std::filesystem;
+    using bench_clock = ss_bench::clock;
+    using ss_bench::msSince;
+
+    // Heap traffic of the render thread only; the plugin's writer thread
+    // may save settings in the background.
+    std::atomic<std::uint64_t> gNewCalls{ 0 };
+    std::atomic<std::uint64_t> gImGuiAllocs{ 0 };
+    thread_local bool tCountAllocs = false;
+
+    void* countingAlloc(std::size_t size, void*) {
+        if (tCountAllocs) gImGuiAllocs.fetch_add(1, std::memory_order_relaxed);
+        return std::malloc(size);
+    }
+    void countingFree(void* ptr, void*) { std::free(ptr); }
+
+    void fillMapLists(int size) {
+        const std::vector<std::string> names = ss_bench::makeMapNames(size);
+        RLTraining.clear();
+        RLTraining.reserve(static_cast<std::size_t>(size));
+        std::vector<WorkshopEntry> workshop;
+        workshop.reserve(static_cast<std::size_t>(size));
+        std::mt19937 rng(static_cast<unsigned>(size));
+        char code[20];
+        for (int i = 0; i < size; ++i) {
+            std::snprintf(code, sizeof(code), "%04X-%04X-%04X-%04X", static_cast<unsigned>(rng() & 0xFFFF),
+                          static_cast<unsigned>(rng() & 0xFFFF), static_cast<unsigned>(rng() & 0xFFFF),
+                          static_cast<unsigned>(rng() & 0xFFFF));
+            RLTraining.push_back({ code, names[i] });
+            workshop.push_back({ "bench/" + std::to_string(i) + ".upk", names[i] });
+        }
+        // Sorted the way a workshop scan leaves it.
+        ss_catalog::assignKeys(workshop);
+        RLWorkshop.clear();
+        ss_catalog::insertSorted(RLWorkshop, std::move(workshop));
+    }
+
+    fs::path redirectDataRoot() {
+        std::error_code ec;
+        fs::path tmp = fs::temp_directory_path(ec);
+        const fs::path root = (ec ? fs::path(".") : tmp) / "suitespot_ui_bench";
+        fs::create_directories(root, ec);
+#if defined(_WIN32)
+        _putenv_s("APPDATA", root.string().c_str());
+#else
+        setenv("APPDATA", root.c_str(), 1);
+#endif
+        return root;
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (tCountAllocs) gNewCalls.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+int main(int argc, char** argv) {
+    int frames = 2000;
+    std::vector<int> sizes;
+    try {
+        if (argc > 1) frames = std::clamp(std::stoi(argv[1]), 2, 100000);
+        for (int i = 2; i < argc; ++i) sizes.push_back(std::clamp(std::stoi(argv[i]), 0, 2000000));
+    } catch (const std::exception&) {
+        std::fprintf(stderr, "usage: %s [frames] [size...]\n", argv[0]);
+        return 2;
+    }
+    if (sizes.empty()) sizes = { 1000, 10000, 100000 };
+
+    const fs::path dataRoot = redirectDataRoot();
+    auto host = std::make_shared<CVarManagerWrapper>();
+    auto game = std::make_shared<GameWrapper>();
+    _globalCvarManager = host;
+
+    ImGui::SetAllocatorFunctions(countingAlloc, countingFree);
+    // One atlas for every scenario, as the host shares one across frames;
+    // it comes from the font cache after the first run.
+    ImFontAtlas fonts;
+    const ss_font::CacheResult r = ss_font::build(fonts, dataRoot / "fonts.atlas");
+    std::fprintf(stderr, "font atlas: %s\n", r == ss_font::CacheResult::Loaded ? "loaded from cache" : "built");
+
+    // Must match the picker labels in RenderSettings.
+    const char* const pickerLabels[] = { "Freeplay Maps", "Training Packs", "Workshop Maps" };
+
+    for (int size : sizes) {
+        fillMapLists(size);
+        // A fresh plugin per size, so its pickers' search indexes start empty.
+        SuiteSpot plugin;
+        plugin.cvarManager = host;
+        plugin.gameWrapper = game;
+        plugin.RegisterSettings();
+
+        for (int mapType = 0; mapType < 3; ++mapType) {
+            plugin.SetSetting<ss_settings::Id::MapType>(mapType);
+            for (bool popup : { false, true }) {
+                ImGuiContext* ctx = ImGui::CreateContext(&fonts);
+                ImGui::SetCurrentContext(ctx);
+                ImGuiIO& io = ImGui::GetIO();
+                io.IniFilename = nullptr;
+                io.LogFilename = nullptr;
+                io.DisplaySize = ImVec2(1280.0f, 720.0f);
+                io.DeltaTime = 1.0f / 60.0f;
+
+                double firstMs = 0, totalMs = 0, worstMs = 0;
+                std::uint64_t steadyAllocs = 0, steadyImGuiAllocs = 0;
+                for (int f = 0; f < frames; ++f) {
+                    const std::uint64_t newBefore = gNewCalls.load(std::memory_order_relaxed);
+                    const std::uint64_t imguiBefore = gImGuiAllocs.load(std::memory_order_relaxed);
+                    tCountAllocs = true;
+                    auto t0 = bench_clock::now();
+                    ImGui::NewFrame();
+                    ImGui::SetNextWindowPos(ImVec2(0, 0));
+                    ImGui::SetNextWindowSize(io.DisplaySize);
+                    ImGui::Begin("SuiteSpot bench", nullptr, ImGuiWindowFlags_NoDecoration);
+                    if (popup && f == 0) ImGui::OpenPopupEx(ImGui::GetID(pickerLabels[mapType]));
+                    plugin.RenderSettings();
+                    ImGui::End();
+                    ImGui::Render();
+                    const double ms = msSince(t0);
+                    tCountAllocs = false;
+                    if (f == 0) {
+                        firstMs = ms;
+                    } else {
+                        totalMs += ms;
+                        worstMs = std::max(worstMs, ms);
+                        const std::uint64_t imgui = gImGuiAllocs.load(std::memory_order_relaxed) - imguiBefore;
+                        steadyImGuiAllocs += imgui;
+                        steadyAllocs += imgui + (gNewCalls.load(std::memory_order_relaxed) - newBefore);
+                    }
+                }
+
+                // Draw data of the last frame; it is the same every steady frame.
+                const ImDrawData* dd = ImGui::GetDrawData();
+                int cmds = 0;
+                for (int i = 0; dd && i < dd->CmdListsCount; ++i) cmds += dd->CmdLists[i]->CmdBuffer.Size;
+                const int steady = frames - 1;
+                std::ostringstream js;
+                js << "{\"bench\":\"ui\",\"maps\":" << size << ",\"map_type\":" << mapType
+                   << ",\"picker_open\":" << (popup ? "true" : "false") << ",\"frames\":" << frames
+                   << ",\"first_frame_ms\":" << firstMs << ",\"ms_per_frame\":" << (totalMs / steady)
+                   << ",\"worst_frame_ms\":" << worstMs
+                   << ",\"allocs_per_frame\":" << (static_cast<double>(steadyAllocs) / steady)
+                   << ",\"imgui_allocs_per_frame\":" << (static_cast<double>(steadyImGuiAllocs) / steady)
+                   << ",\"vertices\":" << (dd ? dd->TotalVtxCount : 0) << ",\"indices\":" << (dd ? dd->TotalIdxCount : 0)
+                   << ",\"draw_cmds\":" << cmds << "}";
+                std::printf("%s\n", js.str().c_str());
+                std::fflush(stdout);
+
+                ImGui::DestroyContext(ctx);
+            }
+        }
+    }
+    return 0;
+}
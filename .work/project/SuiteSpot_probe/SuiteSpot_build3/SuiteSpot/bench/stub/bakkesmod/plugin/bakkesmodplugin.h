@@ -0,0 +1,33 @@
+// bakkesmodplugin.h (bench stub)
+//
+// Plugin base class of the BakkesMod SDK. BAKKESMOD_PLUGIN exports the
+// plugin from the DLL there; the bench creates the plugin itself.
+
+#pragma once
+
+#include "bakkesmod/wrappers/cvarmanagerwrapper.h"
+#include "bakkesmod/wrappers/GameWrapper.h"
+#include <memory>
+
+enum PLUGINTYPE {
+    PLUGINTYPE_FREEPLAY = 0x01,
+    PLUGINTYPE_CUSTOM_TRAINING = 0x02,
+    PLUGINTYPE_SPECTATOR = 0x04,
+    PLUGINTYPE_BOTAI = 0x08,
+    PLUGINTYPE_REPLAY = 0x10,
+    PLUGINTYPE_THREADED = 0x20,
+    PLUGINTYPE_THREADEDUNLOAD = 0x40
+};
+
+#define BAKKESMOD_PLUGIN(classType, pluginName, pluginVersion, pluginType)
+
+namespace BakkesMod::Plugin {
+    class BakkesModPlugin {
+    public:
+        virtual ~BakkesModPlugin() = default;
+        std::shared_ptr<CVarManagerWrapper> cvarManager;
+        std::shared_ptr<GameWrapper> gameWrapper;
+        virtual void onLoad() = 0;
+        virtual void onUnload() = 0;
+    };
+}
@@ -0,0 +1,18 @@
+// GameWrapper.h (bench stub)
+//
+// The subset of the BakkesMod SDK's GameWrapper that SuiteSpot uses. There
+// is no game behind it: hooks are accepted and never fire, and deferred
+// callbacks are dropped.
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+class GameWrapper {
+public:
+    void HookEvent(std::string eventName, std::function<void(std::string eventName)> callback);
+    void UnhookEvent(std::string eventName);
+    void SetTimeout(std::function<void(GameWrapper*)> theLambda, float time);
+    void Execute(std::function<void(GameWrapper*)> theLambda);
+};
@@ -0,0 +1,61 @@
+// cvarmanagerwrapper.h (bench stub)
+//
+// The subset of the BakkesMod SDK's CVarWrapper and CVarManagerWrapper that
+// SuiteSpot uses, with the SDK's signatures. CVars are plain named string
+// values held in the process; setting one runs its change callbacks.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define PERMISSION_ALL 0
+
+class CVarWrapper {
+public:
+    struct State;
+    CVarWrapper() = default;
+    explicit CVarWrapper(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+    bool IsNull() const { return !state_; }
+    explicit operator bool() const { return !IsNull(); }
+
+    bool getBoolValue() const;
+    int getIntValue() const;
+    float getFloatValue() const;
+    std::string getStringValue() const;
+
+    void setValue(std::string value);
+    void setValue(int value);
+    void setValue(float value);
+
+    void addOnValueChanged(std::function<void(std::string oldValue, CVarWrapper cvar)> callback);
+
+private:
+    std::shared_ptr<State> state_;
+};
+
+class CVarManagerWrapper {
+public:
+    CVarManagerWrapper();
+    ~CVarManagerWrapper();
+
+    void log(std::string text);
+    void log(std::wstring text);
+
+    CVarWrapper registerCvar(std::string cvar, std::string defaultValue, std::string desc = "", bool searchAble = true,
+                             bool hasMin = false, float min = 0, bool hasMax = false, float max = 0, bool saveToCfg = true);
+    bool removeCvar(std::string cvar);
+    CVarWrapper getCvar(std::string cvar);
+
+    void registerNotifier(std::string cvar, std::function<void(std::vector<std::string>)> notifier,
+                          std::string description, unsigned char permissions);
+    bool removeNotifier(std::string cvar);
+    void executeCommand(std::string command, bool log = true);
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
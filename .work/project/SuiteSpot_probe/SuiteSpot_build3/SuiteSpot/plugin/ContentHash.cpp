@@ -0,0 +1,125 @@
+// ContentHash.cpp
+//
+// xxHash64 as described in the reference specification, written for
+// little-endian targets (x86/x64, which is all BakkesMod runs on).
+
+#include "pch.h"
+#include "ContentHash.h"
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+namespace ss_hash {
+
+    namespace {
+        constexpr std::uint64_t P1 = 0x9E3779B185EBCA87ULL;
+        constexpr std::uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+        constexpr std::uint64_t P3 = 0x165667B19E3779F9ULL;
+        constexpr std::uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+        constexpr std::uint64_t P5 = 0x27D4EB2F165667C5ULL;
+
+        inline std::uint64_t rotl(std::uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+        inline std::uint64_t read64(const unsigned char* p) { std::uint64_t v; std::memcpy(&v, p, 8); return v; }
+        inline std::uint32_t read32(const unsigned char* p) { std::uint32_t v; std::memcpy(&v, p, 4); return v; }
+
+        inline std::uint64_t round(std::uint64_t acc, std::uint64_t input) {
+            acc += input * P2;
+            acc = rotl(acc, 31);
+            return acc * P1;
+        }
+
+        inline std::uint64_t mergeRound(std::uint64_t acc, std::uint64_t val) {
+            acc ^= round(0, val);
+            return acc * P1 + P4;
+        }
+
+        // Consumes whole 32-byte stripes; returns the number of bytes used.
+        inline std::size_t stripes(std::uint64_t v[4], const unsigned char* p, std::size_t len) {
+            const unsigned char* const start = p;
+            const unsigned char* const limit = p + (len & ~std::size_t(31));
+            std::uint64_t a = v[0], b = v[1], c = v[2], d = v[3];
+            for (; p < limit; p += 32) {
+                a = round(a, read64(p));
+                b = round(b, read64(p + 8));
+                c = round(c, read64(p + 16));
+                d = round(d, read64(p + 24));
+            }
+            v[0] = a; v[1] = b; v[2] = c; v[3] = d;
+            return static_cast<std::size_t>(p - start);
+        }
+    }
+
+    Hasher::Hasher(std::uint64_t seed) : seed_(seed) {
+        v_[0] = seed + P1 + P2;
+        v_[1] = seed + P2;
+        v_[2] = seed;
+        v_[3] = seed - P1;
+    }
+
+    void Hasher::update(const void* data, std::size_t len) {
+        auto p = static_cast<const unsigned char*>(data);
+        total_ += len;
+        if (bufLen_ + len < 32) {
+            std::memcpy(buf_ + bufLen_, p, len);
+            bufLen_ += len;
+            return;
+        }
+        if (bufLen_) {
+            const std::size_t fill = 32 - bufLen_;
+            std::memcpy(buf_ + bufLen_, p, fill);
+            stripes(v_, buf_, 32);
+            p += fill;
+            len -= fill;
+            bufLen_ = 0;
+        }
+        const std::size_t used = stripes(v_, p, len);
+        std::memcpy(buf_, p + used, len - used);
+        bufLen_ = len - used;
+    }
+
+    std::uint64_t Hasher::digest() const {
+        std::uint64_t h;
+        if (total_ >= 32) {
+            h = rotl(v_[0], 1) + rotl(v_[1], 7) + rotl(v_[2], 12) + rotl(v_[3], 18);
+            for (int i = 0; i < 4; ++i) h = mergeRound(h, v_[i]);
+        } else {
+            h = seed_ + P5;
+        }
+        h += total_;
+
+        const unsigned char* p = buf_;
+        std::size_t len = bufLen_;
+        for (; len >= 8; p += 8, len -= 8) h = rotl(h ^ round(0, read64(p)), 27) * P1 + P4;
+        if (len >= 4) { h = rotl(h ^ (std::uint64_t(read32(p)) * P1), 23) * P2 + P3; p += 4; len -= 4; }
+        for (; len > 0; ++p, --len) h = rotl(h ^ (*p * P5), 11) * P1;
+
+        h ^= h >> 33; h *= P2;
+        h ^= h >> 29; h *= P3;
+        h ^= h >> 32;
+        return h;
+    }
+
+    std::uint64_t hash64(const void* data, std::size_t len, std::uint64_t seed) {
+        Hasher h(seed);
+        h.update(data, len);
+        return h.digest();
+    }
+
+    bool hashFile(const fs::path& file, std::uint64_t& out) {
+        std::ifstream in(file, std::ios::binary);
+        if (!in.is_open()) return false;
+        constexpr std::size_t kChunk = 1 << 20;
+        std::unique_ptr<char[]> buf(new char[kChunk]);
+        Hasher h;
+        while (in) {
+            in.read(buf.get(), kChunk);
+            auto n = in.gcount();
+            if (n > 0) h.update(buf.get(), static_cast<std::size_t>(n));
+        }
+        if (in.bad()) return false;
+        out = h.digest();
+        return true;
+    }
+
+} // namespace ss_hash
@@ -0,0 +1,117 @@
+// FrameTimers.cpp
+//
+// Samples live in fixed rings of the last kHistory frames, one start and
+// one duration per section, so recording is two float stores. A section
+// that was not drawn in a frame keeps a zero duration for that frame.
+
+#include "pch.h"
+#include "FrameTimers.h"
+
+#if SUITESPOT_FRAME_TIMERS
+
+#include "IMGUI/imgui_timeline.h"
+#include <algorithm>
+#include <cstdio>
+
+namespace ss_perf {
+
+    namespace {
+        constexpr int kHistory = 120;
+        constexpr int kSections = static_cast<int>(Section::Count);
+        const char* const kNames[kSections] = { "Enable", "Map type", "Queue", "Combos", "Delays" };
+
+        struct State {
+            clock::time_point origin;
+            int head = -1;    // ring slot of the current frame
+            int filled = 0;   // frames recorded, up to kHistory
+            float startMs[kSections][kHistory] = {};
+            float durationMs[kSections][kHistory] = {};
+        };
+
+        State& state() {
+            static State s;
+            return s;
+        }
+
+        float msBetween(clock::time_point a, clock::time_point b) {
+            return std::chrono::duration<float, std::milli>(b - a).count();
+        }
+    }
+
+    void beginFrame() {
+        State& s = state();
+        s.head = (s.head + 1) % kHistory;
+        s.filled = std::min(s.filled + 1, kHistory);
+        for (int i = 0; i < kSections; ++i) {
+            s.startMs[i][s.head] = 0.0f;
+            s.durationMs[i][s.head] = 0.0f;
+        }
+        s.origin = clock::now();
+    }
+
+    void record(Section sec, clock::time_point start, clock::time_point end) {
+        State& s = state();
+        if (s.head < 0) return;
+        const int i = static_cast<int>(sec);
+        s.startMs[i][s.head] = msBetween(s.origin, start);
+        s.durationMs[i][s.head] = msBetween(start, end);
+    }
+
+    void drawOverlay(bool* open) {
+        ImGui::SetNextWindowSize(ImVec2(520, 460), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin("SuiteSpot frame timers", open)) {
+            ImGui::End();
+            return;
+        }
+        const State& s = state();
+        if (s.filled == 0) {
+            ImGui::TextDisabled("Open the SuiteSpot settings page to collect samples.");
+            ImGui::End();
+            return;
+        }
+
+        // The ring is in order once it wraps; before that, slots 0..filled-1 are.
+        const int count = s.filled;
+        const int offset = s.filled == kHistory ? (s.head + 1) % kHistory : 0;
+
+        float avgStart[kSections], avgDuration[kSections], peak[kSections];
+        float pageAvg = 0.0f, scaleMax = 0.0f;
+        for (int i = 0; i < kSections; ++i) {
+            float start = 0.0f, duration = 0.0f;
+            peak[i] = 0.0f;
+            for (int f = 0; f < count; ++f) {
+                start += s.startMs[i][f];
+                duration += s.durationMs[i][f];
+                peak[i] = std::max(peak[i], s.durationMs[i][f]);
+            }
+            avgStart[i] = start / count;
+            avgDuration[i] = duration / count;
+            pageAvg = std::max(pageAvg, avgStart[i] + avgDuration[i]);
+            scaleMax = std::max(scaleMax, peak[i]);
+        }
+
+        ImGui::Text("Settings page: %.3f ms on average over the last %d frames", pageAvg, count);
+        char overlay[64];
+        for (int i = 0; i < kSections; ++i) {
+            std::snprintf(overlay, sizeof(overlay), "%s  avg %.3f ms  max %.3f ms", kNames[i], avgDuration[i], peak[i]);
+            ImGui::PushID(i);
+            ImGui::PlotHistogram("##history", s.durationMs[i], count, offset, overlay, 0.0f, scaleMax,
+                                 ImVec2(-1.0f, 40.0f));
+            ImGui::PopID();
+        }
+
+        // Where each section sits within the page on average. The event
+        // handles are draggable; they edit copies, so dragging does nothing.
+        ImGui::Separator();
+        if (ImGui::BeginTimeline("##sections", std::max(pageAvg, 0.001f))) {
+            for (int i = 0; i < kSections; ++i) {
+                float span[2] = { avgStart[i], avgStart[i] + avgDuration[i] };
+                ImGui::TimelineEvent(kNames[i], span);
+            }
+        }
+        ImGui::EndTimeline();
+        ImGui::End();
+    }
+}
+
+#endif
@@ -0,0 +1,56 @@
+// FrameTimers.h
+//
+// Scoped timers around the sections of SuiteSpot::RenderSettings, with an
+// overlay that shows where in the page each section's time goes (on the
+// imgui_timeline widget) and a rolling histogram of the last frames per
+// section.
+//
+// Built only when SUITESPOT_FRAME_TIMERS is non-zero (the Debug
+// configuration sets it). Otherwise the macros below expand to nothing
+// and FrameTimers.cpp compiles to an empty object.
+
+#pragma once
+
+#ifndef SUITESPOT_FRAME_TIMERS
+#define SUITESPOT_FRAME_TIMERS 0
+#endif
+
+#if SUITESPOT_FRAME_TIMERS
+
+#include <chrono>
+
+namespace ss_perf {
+
+    enum class Section { Enable, MapType, Queue, Combos, Delays, Count };
+
+    using clock = std::chrono::steady_clock;
+
+    // Starts a new frame of samples; section times are taken relative to it.
+    void beginFrame();
+    void record(Section s, clock::time_point start, clock::time_point end);
+
+    // The overlay window; `open` is cleared by its close button.
+    void drawOverlay(bool* open);
+
+    class ScopedSection {
+    public:
+        explicit ScopedSection(Section s) : section_(s), start_(clock::now()) {}
+        ~ScopedSection() { record(section_, start_, clock::now()); }
+        ScopedSection(const ScopedSection&) = delete;
+        ScopedSection& operator=(const ScopedSection&) = delete;
+
+    private:
+        Section section_;
+        clock::time_point start_;
+    };
+}
+
+#define SS_FRAME_TIMERS_BEGIN() ss_perf::beginFrame()
+#define SS_TIME_SECTION(name) ss_perf::ScopedSection ss_section_timer_(ss_perf::Section::name)
+
+#else
+
+#define SS_FRAME_TIMERS_BEGIN() ((void)0)
+#define SS_TIME_SECTION(name) ((void)0)
+
+#endif
@@ -0,0 +1,218 @@
+// FuzzyMatch.cpp
+//
+// Scoring constants and the bonus rules are fzf's (algo.go): a match is
+// worth 16, starting a gap costs 3 and extending it 1, and a matched
+// character gets a bonus for following a non-word character (8), for a
+// camelCase or letter-to-digit step (7), or for being a non-word
+// character itself (8). The first term character's bonus counts double,
+// and inside a consecutive run every character keeps the bonus of the
+// run's first character. For each term the match is the first complete
+// subsequence, shrunk from its end to the shortest window, as in fzf v1.
+
+#include "pch.h"
+#include "FuzzyMatch.h"
+#include <algorithm>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+#define SS_FUZZY_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace ss_search {
+
+    namespace {
+        constexpr int kScoreMatch = 16;
+        constexpr int kGapStart = -3;
+        constexpr int kGapExtension = -1;
+        constexpr int kBonusBoundary = kScoreMatch / 2;
+        constexpr int kBonusNonWord = kScoreMatch / 2;
+        constexpr int kBonusCamel123 = kBonusBoundary + kGapExtension;
+        constexpr int kBonusConsecutive = -(kGapStart + kGapExtension);
+        constexpr int kFirstCharMultiplier = 2;
+        constexpr std::size_t kMaxTerms = 8;
+
+        enum CharClass { NonWord, Lower, Upper, Number, Other };
+
+        inline CharClass classOf(char c) {
+            if (c >= 'a' && c <= 'z') return Lower;
+            if (c >= 'A' && c <= 'Z') return Upper;
+            if (c >= '0' && c <= '9') return Number;
+            if (static_cast<unsigned char>(c) >= 0x80) return Other;
+            return NonWord;
+        }
+
+        inline int bonusFor(CharClass prev, CharClass cur) {
+            if (prev == NonWord && cur != NonWord) return kBonusBoundary;
+            if ((prev == Lower && cur == Upper) || (prev != Number && cur == Number)) return kBonusCamel123;
+            if (cur == NonWord) return kBonusNonWord;
+            return 0;
+        }
+
+        inline char fold(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
+
+        // Letters take bits 0-25; digits share the top six bits.
+        inline std::uint32_t maskBit(char c) {
+            c = fold(c);
+            if (c >= 'a' && c <= 'z') return 1u << (c - 'a');
+            if (c >= '0' && c <= '9') return 1u << (26 + (c - '0') % 6);
+            return 0;
+        }
+
+        inline bool ranksAbove(const FuzzyIndex::Hit& a, std::uint32_t lenA, std::uint32_t ordA,
+                               const FuzzyIndex::Hit& b, std::uint32_t lenB, std::uint32_t ordB) {
+            if (a.score != b.score) return a.score > b.score;
+            if (lenA != lenB) return lenA < lenB;
+            return ordA < ordB;
+        }
+    }
+
+    void FuzzyIndex::clear() {
+        text_.clear();
+        refs_.clear();
+        masks_.clear();
+    }
+
+    void FuzzyIndex::reserve(std::size_t names, std::size_t bytes) {
+        text_.reserve(bytes);
+        refs_.reserve(names);
+        masks_.reserve(names + 3);
+    }
+
+    void FuzzyIndex::add(std::uint8_t source, std::uint32_t id, std::string_view name) {
+        std::uint32_t mask = 0;
+        for (char c : name) mask |= maskBit(c);
+        // Keep the padding invariant: masks_ is size() rounded up to 4, the
+        // pad entries all-zero so they never pass the prefilter.
+        masks_.resize(refs_.size());
+        masks_.push_back(mask);
+        refs_.push_back({ static_cast<std::uint32_t>(text_.size()), static_cast<std::uint32_t>(name.size()), id, source });
+        text_.append(name.data(), name.size());
+        masks_.resize((refs_.size() + 3) & ~std::size_t(3), 0);
+    }
+
+    int FuzzyIndex::scoreTerm(std::string_view name, std::string_view term) {
+        if (term.empty()) return 0;
+        const std::size_t n = name.size();
+        const std::size_t m = term.size();
+
+        // Forward: end of the first complete subsequence.
+        std::size_t pi = 0, end = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (fold(name[i]) == term[pi] && ++pi == m) { end = i + 1; break; }
+        }
+        if (pi < m) return -1;
+        // Backward: latest start that still contains the term before `end`.
+        std::size_t start = end - 1;
+        pi = m - 1;
+        for (std::size_t i = end; i-- > 0;) {
+            if (fold(name[i]) == term[pi]) {
+                if (pi == 0) { start = i; break; }
+                --pi;
+            }
+        }
+
+        int score = 0;
+        int consecutive = 0;
+        int firstBonus = 0;
+        bool inGap = false;
+        CharClass prev = start > 0 ? classOf(name[start - 1]) : NonWord;
+        pi = 0;
+        for (std::size_t i = start; i < end; ++i) {
+            const char c = name[i];
+            const CharClass cls = classOf(c);
+            if (pi < m && fold(c) == term[pi]) {
+                score += kScoreMatch;
+                int bonus = bonusFor(prev, cls);
+                if (consecutive == 0) {
+                    firstBonus = bonus;
+                } else {
+                    if (bonus >= kBonusBoundary && bonus > firstBonus) firstBonus = bonus;
+                    bonus = std::max(std::max(bonus, firstBonus), kBonusConsecutive);
+                }
+                score += (pi == 0) ? bonus * kFirstCharMultiplier : bonus;
+                inGap = false;
+                ++consecutive;
+                ++pi;
+            } else {
+                score += inGap ? kGapExtension : kGapStart;
+                inGap = true;
+                consecutive = 0;
+                firstBonus = 0;
+            }
+            prev = cls;
+        }
+        return score;
+    }
+
+    void FuzzyIndex::rank(std::string_view query, std::size_t k, std::vector<Hit>& out) const {
+        out.clear();
+        if (k == 0 || refs_.empty()) return;
+
+        // Split into folded terms.
+        std::string folded;
+        folded.reserve(query.size());
+        std::string_view terms[kMaxTerms];
+        std::size_t termCount = 0;
+        std::uint32_t want = 0;
+        for (char c : query) folded.push_back(fold(c));
+        for (std::size_t i = 0; i < folded.size() && termCount < kMaxTerms;) {
+            while (i < folded.size() && (folded[i] == ' ' || folded[i] == '\t')) ++i;
+            const std::size_t b = i;
+            while (i < folded.size() && folded[i] != ' ' && folded[i] != '\t') want |= maskBit(folded[i++]);
+            if (i > b) terms[termCount++] = std::string_view(folded).substr(b, i - b);
+        }
+        if (termCount == 0) return;
+
+        // Heap ordered by `better`, so its root is the weakest hit kept.
+        struct Entry { Hit hit; std::uint32_t length; std::uint32_t order; };
+        std::vector<Entry> heap;
+        heap.reserve(k);
+        auto better = [](const Entry& a, const Entry& b) {
+            return ranksAbove(a.hit, a.length, a.order, b.hit, b.length, b.order);
+        };
+        auto consider = [&](std::size_t idx) {
+            const Ref& r = refs_[idx];
+            const std::string_view name(text_.data() + r.offset, r.length);
+            int total = 0;
+            for (std::size_t t = 0; t < termCount; ++t) {
+                const int s = scoreTerm(name, terms[t]);
+                if (s < 0) return;
+                total += s;
+            }
+            Entry e{ { total, r.source, r.id }, r.length, static_cast<std::uint32_t>(idx) };
+            if (heap.size() < k) {
+                heap.push_back(e);
+                std::push_heap(heap.begin(), heap.end(), better);
+            } else if (better(e, heap.front())) {
+                std::pop_heap(heap.begin(), heap.end(), better);
+                heap.back() = e;
+                std::push_heap(heap.begin(), heap.end(), better);
+            }
+        };
+
+        const std::size_t count = refs_.size();
+#if SS_FUZZY_SSE2
+        const __m128i q = _mm_set1_epi32(static_cast<int>(want));
+        for (std::size_t base = 0; base < count; base += 4) {
+            const __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i*>(masks_.data() + base));
+            const __m128i hit = _mm_cmpeq_epi32(_mm_and_si128(m, q), q);
+            unsigned bits = static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(hit)));
+            while (bits) {
+                const unsigned lane = bits & (0u - bits);
+                bits ^= lane;
+                const std::size_t idx = base + (lane == 1 ? 0 : lane == 2 ? 1 : lane == 4 ? 2 : 3);
+                if (idx < count) consider(idx);
+            }
+        }
+#else
+        for (std::size_t idx = 0; idx < count; ++idx) {
+            if ((masks_[idx] & want) == want) consider(idx);
+        }
+#endif
+
+        std::sort_heap(heap.begin(), heap.end(), better);
+        out.reserve(heap.size());
+        for (const Entry& e : heap) out.push_back(e.hit);
+    }
+
+} // namespace ss_search
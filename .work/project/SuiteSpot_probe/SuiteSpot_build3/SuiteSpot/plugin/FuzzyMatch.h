@@ -0,0 +1,61 @@
+// FuzzyMatch.h
+//
+// fzf-style fuzzy ranking over the names of every map list at once, for
+// queries like "dfh snw" -> "DFH Stadium (Snowy)". A query is split on
+// spaces into terms; a name matches if every term appears in it as a
+// subsequence (case-insensitive), and scores by how tightly and where
+// the letters land: consecutive runs, word starts and camelCase humps
+// score high, gaps cost. The scoring follows fzf's v1 algorithm.
+//
+// Every name carries a 32-bit mask of the letters and digits it contains.
+// Ranking first compares the query's mask against four names at a time
+// with SSE2 and only scores names that have every query character, then
+// keeps the best k in a min-heap, so cost is one pass over the masks plus
+// the (usually few) real candidates.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ss_search {
+
+    class FuzzyIndex {
+    public:
+        struct Hit {
+            int score;
+            std::uint8_t source;  // caller-defined list tag (freeplay, training, ...)
+            std::uint32_t id;     // position in that list
+        };
+
+        void clear();
+        void reserve(std::size_t names, std::size_t bytes);
+        void add(std::uint8_t source, std::uint32_t id, std::string_view name);
+        std::size_t size() const { return refs_.size(); }
+
+        // Up to `k` best matches for `query`, best first. Equal scores
+        // prefer the shorter name, then insertion order. A blank query
+        // yields nothing.
+        void rank(std::string_view query, std::size_t k, std::vector<Hit>& out) const;
+
+        // Scores one name against one already-folded, space-free term;
+        // -1 if the term is not a subsequence of the name. Exposed for the
+        // benchmark and for checking rankings by hand.
+        static int scoreTerm(std::string_view name, std::string_view term);
+
+    private:
+        struct Ref {
+            std::uint32_t offset;  // into text_
+            std::uint32_t length;
+            std::uint32_t id;
+            std::uint8_t source;
+        };
+
+        std::string text_;                // names back to back, original case
+        std::vector<Ref> refs_;
+        std::vector<std::uint32_t> masks_; // per name, padded to a multiple of 4
+    };
+}
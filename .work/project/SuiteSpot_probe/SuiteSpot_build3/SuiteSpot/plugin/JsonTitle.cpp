@@ -0,0 +1,222 @@
+// JsonTitle.cpp
+//
+// Streaming top-level key lookup declared in JsonTitle.h. The parser is
+// deliberately lenient about things that do not affect finding the key
+// (number syntax, control characters inside strings) and strict about
+// structure, so a malformed file simply yields "not found".
+
+#include "pch.h"
+#include "JsonTitle.h"
+#include <cstdint>
+#include <fstream>
+
+namespace ss_json {
+
+    namespace {
+        constexpr int kEof = -1;
+
+        // Byte source over either a file (read in chunks) or a memory span.
+        class Reader {
+        public:
+            Reader(std::istream* in, std::size_t limit) : in_(in), limit_(limit) {}
+            Reader(std::string_view mem, std::size_t limit)
+                : data_(mem.data()), len_(mem.size() < limit ? mem.size() : limit), limit_(limit) {}
+
+            int peek() {
+                if (pos_ == len_ && !refill()) return kEof;
+                return static_cast<unsigned char>(data_[pos_]);
+            }
+            int get() {
+                int c = peek();
+                if (c != kEof) { ++pos_; ++consumed_; }
+                return c;
+            }
+            std::size_t consumed() const { return consumed_; }
+
+        private:
+            bool refill() {
+                if (!in_ || consumed_ >= limit_) return false;
+                std::size_t want = sizeof(buf_);
+                if (want > limit_ - consumed_) want = limit_ - consumed_;
+                in_->read(buf_, static_cast<std::streamsize>(want));
+                len_ = static_cast<std::size_t>(in_->gcount());
+                pos_ = 0;
+                data_ = buf_;
+                return len_ > 0;
+            }
+
+            std::istream* in_ = nullptr;
+            const char* data_ = nullptr;
+            std::size_t pos_ = 0;
+            std::size_t len_ = 0;
+            std::size_t consumed_ = 0;
+            std::size_t limit_ = 0;
+            char buf_[4096];
+        };
+
+        bool isWs(int c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+        void skipWs(Reader& r) { while (isWs(r.peek())) r.get(); }
+
+        int hexVal(int c) {
+            if (c >= '0' && c <= '9') return c - '0';
+            if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+            return -1;
+        }
+
+        bool readHex4(Reader& r, std::uint32_t& out) {
+            out = 0;
+            for (int i = 0; i < 4; ++i) {
+                int v = hexVal(r.get());
+                if (v < 0) return false;
+                out = (out << 4) | static_cast<std::uint32_t>(v);
+            }
+            return true;
+        }
+
+        void appendUtf8(std::string& s, std::uint32_t cp) {
+            if (cp < 0x80) {
+                s += static_cast<char>(cp);
+            } else if (cp < 0x800) {
+                s += static_cast<char>(0xC0 | (cp >> 6));
+                s += static_cast<char>(0x80 | (cp & 0x3F));
+            } else if (cp < 0x10000) {
+                s += static_cast<char>(0xE0 | (cp >> 12));
+                s += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                s += static_cast<char>(0x80 | (cp & 0x3F));
+            } else {
+                s += static_cast<char>(0xF0 | (cp >> 18));
+                s += static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+                s += static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                s += static_cast<char>(0x80 | (cp & 0x3F));
+            }
+        }
+
+        // Reads a string body (opening quote already consumed). When `out`
+        // is null the contents are skipped without being decoded.
+        bool readString(Reader& r, std::string* out) {
+            while (true) {
+                int c = r.get();
+                if (c == kEof) return false;
+                if (c == '"') return true;
+                if (c != '\\') { if (out) *out += static_cast<char>(c); continue; }
+
+                int e = r.get();
+                if (!out) { if (e == kEof) return false; continue; }
+                switch (e) {
+                case '"':  *out += '"'; break;
+                case '\\': *out += '\\'; break;
+                case '/':  *out += '/'; break;
+                case 'b':  *out += '\b'; break;
+                case 'f':  *out += '\f'; break;
+                case 'n':  *out += '\n'; break;
+                case 'r':  *out += '\r'; break;
+                case 't':  *out += '\t'; break;
+                case 'u': {
+                    std::uint32_t cp;
+                    if (!readHex4(r, cp)) return false;
+                    if (cp >= 0xD800 && cp <= 0xDBFF) {
+                        // High surrogate; a low surrogate should follow.
+                        std::uint32_t lo;
+                        if (r.peek() == '\\') {
+                            r.get();
+                            if (r.get() != 'u' || !readHex4(r, lo)) return false;
+                            if (lo >= 0xDC00 && lo <= 0xDFFF) {
+                                cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+                            } else {
+                                appendUtf8(*out, 0xFFFD);
+                                cp = lo;
+                            }
+                        } else {
+                            cp = 0xFFFD;
+                        }
+                    } else if (cp >= 0xDC00 && cp <= 0xDFFF) {
+                        cp = 0xFFFD;
+                    }
+                    appendUtf8(*out, cp);
+                    break;
+                }
+                default:
+                    return false;
+                }
+            }
+        }
+
+        // Skips one value of any type. Stops before the ',' or closing
+        // bracket that ends it.
+        bool skipValue(Reader& r) {
+            int depth = 0;
+            while (true) {
+                int c = r.peek();
+                if (c == kEof) return false;
+                if (c == '"') {
+                    r.get();
+                    if (!readString(r, nullptr)) return false;
+                    if (depth == 0) return true;
+                    continue;
+                }
+                if (c == '{' || c == '[') { r.get(); ++depth; continue; }
+                if (c == '}' || c == ']') {
+                    if (depth == 0) return true;
+                    r.get();
+                    if (--depth == 0) return true;
+                    continue;
+                }
+                if (c == ',' && depth == 0) return true;
+                r.get();
+            }
+        }
+
+        Lookup find(Reader& r, std::string_view key) {
+            Lookup res;
+            // Tolerate a UTF-8 BOM.
+            if (r.peek() == 0xEF) {
+                r.get();
+                if (r.get() != 0xBB || r.get() != 0xBF) { res.bytesRead = r.consumed(); return res; }
+            }
+            skipWs(r);
+            if (r.get() != '{') { res.bytesRead = r.consumed(); return res; }
+
+            std::string name;
+            while (true) {
+                skipWs(r);
+                int c = r.get();
+                if (c != '"') break; // '}' (no more keys) or malformed
+                name.clear();
+                if (!readString(r, &name)) break;
+                skipWs(r);
+                if (r.get() != ':') break;
+                skipWs(r);
+                if (name == key) {
+                    if (r.get() == '"' && readString(r, &res.value)) res.found = true;
+                    else res.value.clear();
+                    break;
+                }
+                if (!skipValue(r)) break;
+                skipWs(r);
+                if (r.get() != ',') break;
+            }
+            res.bytesRead = r.consumed();
+            return res;
+        }
+    }
+
+    Lookup findTopLevelString(const fs::path& path, std::string_view key, std::size_t maxBytes) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open()) return {};
+        Reader r(&in, maxBytes);
+        return find(r, key);
+    }
+
+    Lookup findTopLevelString(std::string_view json, std::string_view key, std::size_t maxBytes) {
+        Reader r(json, maxBytes);
+        return find(r, key);
+    }
+
+    std::string readTitle(const fs::path& jsonPath) {
+        auto res = findTopLevelString(jsonPath, "title");
+        return res.found ? std::move(res.value) : std::string{};
+    }
+
+} // namespace ss_json
@@ -0,0 +1,40 @@
+// JsonTitle.h
+//
+// Bounded streaming lookup of a top-level string field in a JSON document,
+// used to read map titles from workshop sidecar files. The tokenizer pulls
+// the file in small chunks, skips nested objects and arrays without
+// materialising them, decodes string escapes (including \uXXXX surrogate
+// pairs) to UTF-8, and stops as soon as the key is found or the byte
+// budget runs out. Only the top-level object is searched, so a "title"
+// nested inside another object is never picked up.
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace ss_json {
+    namespace fs = std::filesystem;
+
+    // Upper bound on bytes read from one sidecar file.
+    constexpr std::size_t kMaxScanBytes = 1024 * 1024;
+
+    struct Lookup {
+        bool found = false;
+        std::string value;          // UTF-8, escapes decoded
+        std::size_t bytesRead = 0;  // bytes consumed from the source
+    };
+
+    // Looks up `key` in the top-level object of the file at `path`.
+    Lookup findTopLevelString(const fs::path& path, std::string_view key,
+                              std::size_t maxBytes = kMaxScanBytes);
+
+    // Same, over an in-memory document.
+    Lookup findTopLevelString(std::string_view json, std::string_view key,
+                              std::size_t maxBytes = kMaxScanBytes);
+
+    // Convenience for sidecars: the top-level "title", or empty.
+    std::string readTitle(const fs::path& jsonPath);
+}
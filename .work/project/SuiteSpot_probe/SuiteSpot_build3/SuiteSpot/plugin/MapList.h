@@ -20,5 +20,6 @@ extern std::vector<TrainingEntry> RLTraining;
 struct WorkshopEntry {
     std::string filePath;
     std::string name;      
+    std::string sortKey{}; // ss_catalog::collationKey(name), set before entering RLWorkshop
 };
 extern std::vector<WorkshopEntry> RLWorkshop;
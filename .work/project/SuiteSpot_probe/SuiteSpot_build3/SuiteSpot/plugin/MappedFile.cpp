@@ -0,0 +1,83 @@
+// MappedFile.cpp
+//
+// CreateFileMappingW/MapViewOfFile on Windows, mmap elsewhere. The file
+// handle is closed right after mapping; the mapping keeps the view alive.
+
+#include "pch.h"
+#include "MappedFile.h"
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ss_io {
+
+    bool MappedFile::open(const fs::path& file) {
+        close();
+#if defined(_WIN32)
+        HANDLE h = CreateFileW(file.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                               nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (h == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER size{};
+        if (!GetFileSizeEx(h, &size)) { CloseHandle(h); return false; }
+        if (size.QuadPart == 0) { CloseHandle(h); open_ = true; return true; }
+        HANDLE m = CreateFileMappingW(h, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(h);
+        if (!m) return false;
+        void* p = MapViewOfFile(m, FILE_MAP_READ, 0, 0, 0);
+        if (!p) { CloseHandle(m); return false; }
+        mapping_ = m;
+        data_ = static_cast<const char*>(p);
+        size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+        int fd = ::open(file.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) { ::close(fd); return false; }
+        if (st.st_size == 0) { ::close(fd); open_ = true; return true; }
+        int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+        flags |= MAP_POPULATE; // callers read the whole file; fault it in with one call
+#endif
+        void* p = ::mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, flags, fd, 0);
+        ::close(fd);
+        if (p == MAP_FAILED) return false;
+        ::madvise(p, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+        data_ = static_cast<const char*>(p);
+        size_ = static_cast<std::size_t>(st.st_size);
+#endif
+        open_ = true;
+        return true;
+    }
+
+    void MappedFile::close() {
+        if (data_) {
+#if defined(_WIN32)
+            UnmapViewOfFile(data_);
+            CloseHandle(static_cast<HANDLE>(mapping_));
+            mapping_ = nullptr;
+#else
+            ::munmap(const_cast<char*>(data_), size_);
+#endif
+        }
+        data_ = nullptr;
+        size_ = 0;
+        open_ = false;
+    }
+
+    void MappedFile::swap(MappedFile& o) noexcept {
+        std::swap(data_, o.data_);
+        std::swap(size_, o.size_);
+        std::swap(open_, o.open_);
+#if defined(_WIN32)
+        std::swap(mapping_, o.mapping_);
+#endif
+    }
+
+} // namespace ss_io
@@ -0,0 +1,47 @@
+// MappedFile.h
+//
+// Read-only memory mapping of a whole file, for parsers that want to walk
+// the bytes in place with std::string_view instead of copying them through
+// a stream. The view stays valid until the MappedFile is destroyed or
+// moved from. Empty files open successfully with an empty view.
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace ss_io {
+    namespace fs = std::filesystem;
+
+    class MappedFile {
+    public:
+        MappedFile() = default;
+        ~MappedFile() { close(); }
+
+        MappedFile(MappedFile&& o) noexcept { swap(o); }
+        MappedFile& operator=(MappedFile&& o) noexcept { if (this != &o) { close(); swap(o); } return *this; }
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        // Maps `file`; returns false (and leaves the object closed) if it
+        // cannot be opened or mapped.
+        bool open(const fs::path& file);
+        void close();
+
+        bool isOpen() const { return open_; }
+        const char* data() const { return data_; }
+        std::size_t size() const { return size_; }
+        std::string_view view() const { return { data_, size_ }; }
+
+    private:
+        void swap(MappedFile& o) noexcept;
+
+        const char* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool open_ = false;
+#if defined(_WIN32)
+        void* mapping_ = nullptr; // HANDLE
+#endif
+    };
+}
@@ -0,0 +1,450 @@
+// MirrorEngine.cpp
+//
+// Implementation of ss_mirror::mirror. Listing happens first (both trees in
+// parallel via ss_walk::scan), then the copy plan is sorted largest file
+// first so one huge map does not end up as the last job on a single worker.
+// Dedup mode runs the same listing and worker pool but hashes files and
+// links them to store objects instead of copying each one.
+
+#include "pch.h"
+#include "MirrorEngine.h"
+#include "ContentHash.h"
+#include "WorkshopWalker.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <linux/fs.h>
+#endif
+#endif
+
+namespace ss_mirror {
+
+    namespace {
+        struct FileMeta {
+            std::uintmax_t size = 0;
+            std::int64_t mtime = 0;
+        };
+
+        struct SrcFile {
+            fs::path rel;
+            FileMeta meta;
+        };
+
+        // Both trees, as seen by one listing pass each.
+        struct TreeListing {
+            std::vector<fs::path> dirs;   // relative to the root
+            std::vector<SrcFile> files;
+        };
+
+        TreeListing listTree(const fs::path& root) {
+            TreeListing out;
+            std::mutex m;
+            ss_walk::ScanSpec spec;
+            ss_walk::scan({ root }, spec, [&](ss_walk::Listing& l) {
+                std::vector<SrcFile> files;
+                files.reserve(l.files.size());
+                for (const auto& f : l.files) {
+                    SrcFile sf;
+                    if (!ss_walk::fileMeta(f, sf.meta.size, sf.meta.mtime)) continue;
+                    sf.rel = f.path().lexically_relative(root);
+                    files.push_back(std::move(sf));
+                }
+                std::lock_guard<std::mutex> lk(m);
+                for (const auto& d : l.subdirs) out.dirs.push_back(d.path().lexically_relative(root));
+                out.files.insert(out.files.end(), std::make_move_iterator(files.begin()),
+                                 std::make_move_iterator(files.end()));
+                return true;
+            });
+            return out;
+        }
+
+#if defined(_WIN32)
+        bool copyFile(const fs::path& from, const fs::path& to) {
+            // Kernel-side copy; also carries the last write time over.
+            return CopyFileW(from.c_str(), to.c_str(), FALSE) != 0;
+        }
+#else
+        bool copyLoop(int in, int out) {
+            char buf[256 * 1024];
+            while (true) {
+                ssize_t n = ::read(in, buf, sizeof(buf));
+                if (n == 0) return true;
+                if (n < 0) { if (errno == EINTR) continue; return false; }
+                for (ssize_t off = 0; off < n;) {
+                    ssize_t w = ::write(out, buf + off, static_cast<size_t>(n - off));
+                    if (w < 0) { if (errno == EINTR) continue; return false; }
+                    off += w;
+                }
+            }
+        }
+
+        bool copyFile(const fs::path& from, const fs::path& to) {
+            int in = ::open(from.c_str(), O_RDONLY | O_CLOEXEC);
+            if (in < 0) return false;
+            struct stat st;
+            if (::fstat(in, &st) != 0) { ::close(in); return false; }
+            int out = ::open(to.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, st.st_mode & 0777);
+            if (out < 0) { ::close(in); return false; }
+
+            bool ok = false;
+#if defined(FICLONE)
+            // Reflink: shares extents on btrfs/XFS, no data is copied.
+            ok = ::ioctl(out, FICLONE, in) == 0;
+#endif
+            if (!ok) {
+                off_t remaining = st.st_size;
+                bool fallback = false;
+                ok = true;
+                while (remaining > 0) {
+                    ssize_t n = ::copy_file_range(in, nullptr, out, nullptr, static_cast<size_t>(remaining), 0);
+                    if (n > 0) { remaining -= n; continue; }
+                    if (n < 0 && errno == EINTR) continue;
+                    // Cross-device or unsupported before anything was written:
+                    // plain read/write from the start.
+                    if (n < 0 && remaining == st.st_size &&
+                        (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP)) {
+                        fallback = true;
+                    } else if (n < 0) {
+                        ok = false;
+                    }
+                    break; // n == 0: source shrank underneath us; keep what we have
+                }
+                if (fallback) ok = copyLoop(in, out);
+            }
+            if (ok) {
+                const struct timespec times[2] = { st.st_atim, st.st_mtim };
+                ok = ::futimens(out, times) == 0;
+            }
+            ::close(in);
+            if (::close(out) != 0) ok = false;
+            if (!ok) ::unlink(to.c_str());
+            return ok;
+        }
+#endif
+
+        // Copies into a sibling temp file and renames it over `to`. Writing
+        // through `to` directly would also change every other name of it:
+        // a dedup mirror's files are hard links into the shared store.
+        bool replaceFile(const fs::path& from, const fs::path& to) {
+            fs::path tmp = to;
+            tmp += ".sscopy";
+            std::error_code ec;
+            fs::remove(tmp, ec);
+            if (!copyFile(from, tmp)) return false;
+            fs::rename(tmp, to, ec);
+            if (ec) { fs::remove(tmp, ec); return false; }
+            return true;
+        }
+
+        // Runs fn(i) for i in [0, count) on up to `threads` workers.
+        template <typename Fn>
+        void runPool(std::size_t count, unsigned threads, Fn&& fn) {
+            if (count == 0) return;
+            unsigned n = threads;
+            if (n == 0) n = std::clamp(std::thread::hardware_concurrency(), 1u, 4u);
+            n = static_cast<unsigned>(std::min<std::size_t>(n, count));
+            std::atomic<std::size_t> next{ 0 };
+            auto worker = [&] {
+                for (std::size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < count;) fn(i);
+            };
+            std::vector<std::thread> pool;
+            for (unsigned i = 1; i < n; ++i) pool.emplace_back(worker);
+            worker();
+            for (auto& t : pool) t.join();
+        }
+
+        // ---- dedup store ----
+
+        struct HashEntry {
+            std::uintmax_t size = 0;
+            std::int64_t mtime = 0;
+            std::uint64_t hash = 0;
+        };
+        using HashCache = std::unordered_map<std::string, HashEntry>; // source path -> hash
+
+        // hashes.txt: one "H<TAB>size<TAB>mtime<TAB>hash<TAB>path" line per file.
+        HashCache loadHashCache(const fs::path& file) {
+            HashCache cache;
+            std::ifstream in(file.string());
+            std::string line;
+            while (std::getline(in, line)) {
+                if (line.size() < 2 || line[0] != 'H' || line[1] != '\t') continue;
+                char* end = nullptr;
+                const char* p = line.c_str() + 2;
+                HashEntry e;
+                e.size = std::strtoull(p, &end, 10);
+                if (*end != '\t') continue;
+                e.mtime = std::strtoll(end + 1, &end, 10);
+                if (*end != '\t') continue;
+                e.hash = std::strtoull(end + 1, &end, 16);
+                if (*end != '\t') continue;
+                cache[std::string(end + 1)] = e;
+            }
+            return cache;
+        }
+
+        void saveHashCache(const fs::path& file, const HashCache& cache) {
+            fs::path tmp = file;
+            tmp += ".tmp";
+            {
+                std::ofstream out(tmp.string(), std::ios::trunc);
+                if (!out.is_open()) return;
+                char hex[17];
+                for (const auto& [path, e] : cache) {
+                    std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(e.hash));
+                    out << "H\t" << e.size << '\t' << e.mtime << '\t' << hex << '\t' << path << '\n';
+                }
+                if (!out) return;
+            }
+            std::error_code ec;
+            fs::rename(tmp, file, ec);
+            if (ec) fs::remove(tmp, ec);
+        }
+
+        // Store objects are named by hash and size, fanned out by the
+        // first hash byte to keep directories small.
+        fs::path objectRel(std::uint64_t hash, std::uintmax_t size) {
+            char hex[17];
+            std::snprintf(hex, sizeof(hex), "%016llx", static_cast<unsigned long long>(hash));
+            return fs::path(std::string(hex, 2)) / (std::string(hex) + "-" + std::to_string(size));
+        }
+    }
+
+    using MetaMap = std::unordered_map<fs::path::string_type, FileMeta>;
+
+    // Dedup half of mirror(): `from`, `existing` (dst files) and `storeTree`
+    // come from the shared listing pass.
+    static Stats mirrorDedup(const fs::path& src, const fs::path& dst, const Options& opt,
+                             const TreeListing& from, const MetaMap& existing,
+                             const TreeListing& storeTree, Stats stats) {
+        const fs::path& storeDir = opt.dedupStore;
+        const fs::path cacheFile = storeDir / "hashes.txt";
+        std::error_code ec;
+        fs::create_directories(storeDir, ec);
+
+        HashCache cache = loadHashCache(cacheFile);
+        bool cacheDirty = false;
+
+        std::mutex objMutex;
+        MetaMap objects;
+        objects.reserve(storeTree.files.size());
+        for (const auto& f : storeTree.files) objects.emplace(f.rel.native(), f.meta);
+
+        // A mirrored file is current when it has the object's size and
+        // mtime; as a hard link it shares both with the object.
+        auto isCurrent = [&](const SrcFile& f, const FileMeta& obj) {
+            auto it = existing.find(f.rel.native());
+            return it != existing.end() && it->second.size == obj.size && it->second.mtime == obj.mtime;
+        };
+
+        struct Work {
+            const SrcFile* file;
+            std::string key;
+            std::uint64_t hash = 0;
+            bool known = false;
+        };
+        std::vector<Work> plan;
+        std::unordered_set<std::string> seen;
+        seen.reserve(from.files.size());
+        for (const auto& f : from.files) {
+            Work w{ &f, (src / f.rel).string() };
+            seen.insert(w.key);
+            auto c = cache.find(w.key);
+            if (c != cache.end() && c->second.size == f.meta.size && c->second.mtime == f.meta.mtime) {
+                ++stats.hashCacheHits;
+                w.hash = c->second.hash;
+                w.known = true;
+                auto obj = objects.find(objectRel(w.hash, f.meta.size).native());
+                if (obj != objects.end() && isCurrent(f, obj->second)) { ++stats.upToDate; continue; }
+            }
+            plan.push_back(std::move(w));
+        }
+        std::sort(plan.begin(), plan.end(),
+                  [](const Work& a, const Work& b) { return a.file->meta.size > b.file->meta.size; });
+
+        std::atomic<std::size_t> copied{ 0 }, linked{ 0 }, failed{ 0 }, hashed{ 0 }, upToDate{ 0 };
+        std::atomic<std::uintmax_t> bytesCopied{ 0 }, bytesStored{ 0 };
+        std::atomic<unsigned> tmpSeq{ 0 };
+        runPool(plan.size(), opt.threads, [&](std::size_t i) {
+            Work& w = plan[i];
+            const SrcFile& f = *w.file;
+            const fs::path from = src / f.rel;
+            const fs::path to = dst / f.rel;
+            std::error_code ec;
+
+            if (!w.known) {
+                if (!ss_hash::hashFile(from, w.hash)) { ++failed; return; }
+                ++hashed;
+                w.known = true;
+            }
+
+            const fs::path rel = objectRel(w.hash, f.meta.size);
+            const fs::path obj = storeDir / rel;
+            FileMeta objMeta;
+            bool have;
+            {
+                std::lock_guard<std::mutex> lk(objMutex);
+                auto it = objects.find(rel.native());
+                have = it != objects.end();
+                if (have) objMeta = it->second;
+            }
+            if (!have) {
+                // Copy into a private temp name, then publish it with a
+                // no-clobber hard link so two workers racing on the same
+                // content end up sharing one object.
+                fs::create_directories(obj.parent_path(), ec);
+                fs::path tmp = obj;
+                tmp += ".tmp" + std::to_string(tmpSeq++);
+                if (!copyFile(from, tmp)) { ++failed; return; }
+                fs::create_hard_link(tmp, obj, ec);
+                if (!ec) {
+                    fs::remove(tmp, ec);
+                    bytesStored += f.meta.size;
+                    objMeta = f.meta;
+                } else if (fs::exists(obj, ec)) {
+                    fs::remove(tmp, ec);
+                    std::uintmax_t size = 0;
+                    if (!ss_walk::fileMeta(fs::directory_entry(obj, ec), size, objMeta.mtime)) { ++failed; return; }
+                    objMeta.size = size;
+                } else {
+                    // Store filesystem without hard links: move it into place.
+                    fs::rename(tmp, obj, ec);
+                    if (ec) { fs::remove(tmp, ec); ++failed; return; }
+                    bytesStored += f.meta.size;
+                    objMeta = f.meta;
+                }
+                std::lock_guard<std::mutex> lk(objMutex);
+                objects.emplace(rel.native(), objMeta);
+            }
+
+            if (isCurrent(f, objMeta)) { ++upToDate; return; }
+
+            fs::path link = to;
+            link += ".sslink";
+            fs::remove(link, ec);
+            fs::create_hard_link(obj, link, ec);
+            if (!ec) {
+                fs::rename(link, to, ec);
+                if (!ec) { ++linked; return; }
+                fs::remove(link, ec);
+            }
+            // Store on another volume (or no link support): reflink/copy.
+            if (replaceFile(obj, to)) {
+                ++copied;
+                bytesCopied += f.meta.size;
+            } else {
+                ++failed;
+            }
+        });
+
+        // Record new hashes; forget files that vanished from this source
+        // (entries for other mirrored roots sharing the store are kept).
+        for (const auto& w : plan) {
+            if (!w.known) continue;
+            auto& e = cache[w.key];
+            if (e.hash != w.hash || e.size != w.file->meta.size || e.mtime != w.file->meta.mtime) {
+                e = { w.file->meta.size, w.file->meta.mtime, w.hash };
+                cacheDirty = true;
+            }
+        }
+        fs::path prefixPath = src;
+        prefixPath /= "";
+        const std::string prefix = prefixPath.string();
+        for (auto it = cache.begin(); it != cache.end();) {
+            if (it->first.compare(0, prefix.size(), prefix) == 0 && !seen.count(it->first)) {
+                it = cache.erase(it);
+                cacheDirty = true;
+            } else {
+                ++it;
+            }
+        }
+        if (cacheDirty) saveHashCache(cacheFile, cache);
+
+        stats.copied = copied;
+        stats.linked = linked;
+        stats.failed = failed;
+        stats.hashed = hashed;
+        stats.upToDate += upToDate;
+        stats.bytesCopied = bytesCopied;
+        stats.bytesStored = bytesStored;
+        return stats;
+    }
+
+    Stats mirror(const fs::path& src, const fs::path& dst, const Options& opt) {
+        Stats stats;
+        std::error_code ec;
+        if (!fs::is_directory(src, ec)) return stats;
+        fs::create_directories(dst, ec);
+
+        const bool dedup = !opt.dedupStore.empty();
+        TreeListing from, to, store;
+        std::thread dstLister([&] { to = listTree(dst); });
+        std::thread storeLister([&] { if (dedup) store = listTree(opt.dedupStore); });
+        from = listTree(src);
+        dstLister.join();
+        storeLister.join();
+
+        // Directories first, parents before children.
+        std::unordered_set<fs::path::string_type> haveDirs;
+        for (const auto& d : to.dirs) haveDirs.insert(d.native());
+        std::sort(from.dirs.begin(), from.dirs.end());
+        for (const auto& d : from.dirs) {
+            if (haveDirs.count(d.native())) continue;
+            fs::create_directories(dst / d, ec);
+        }
+
+        std::unordered_map<fs::path::string_type, FileMeta> existing;
+        existing.reserve(to.files.size());
+        for (auto& f : to.files) existing.emplace(f.rel.native(), f.meta);
+        stats.files = from.files.size();
+
+        if (dedup) return mirrorDedup(src, dst, opt, from, existing, store, stats);
+
+        std::vector<const SrcFile*> plan;
+        for (const auto& f : from.files) {
+            auto it = existing.find(f.rel.native());
+            if (it != existing.end() && it->second.size == f.meta.size && it->second.mtime == f.meta.mtime) {
+                ++stats.upToDate;
+                continue;
+            }
+            plan.push_back(&f);
+        }
+        std::sort(plan.begin(), plan.end(),
+                  [](const SrcFile* a, const SrcFile* b) { return a->meta.size > b->meta.size; });
+
+        std::atomic<std::size_t> copied{ 0 }, failed{ 0 };
+        std::atomic<std::uintmax_t> bytes{ 0 };
+        runPool(plan.size(), opt.threads, [&](std::size_t i) {
+            const SrcFile& f = *plan[i];
+            if (replaceFile(src / f.rel, dst / f.rel)) {
+                ++copied;
+                bytes += f.meta.size;
+            } else {
+                ++failed;
+            }
+        });
+
+        stats.copied = copied;
+        stats.failed = failed;
+        stats.bytesCopied = bytes;
+        return stats;
+    }
+
+} // namespace ss_mirror
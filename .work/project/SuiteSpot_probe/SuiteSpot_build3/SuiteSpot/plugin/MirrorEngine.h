@@ -0,0 +1,52 @@
+// MirrorEngine.h
+//
+// One-way directory mirror used by SuiteSpot::MirrorDirectory. Source and
+// destination trees are each listed once with the shared scan engine
+// (WorkshopWalker.h), so size and mtime for every file come from that
+// single pass instead of separate exists/last_write_time/file_size calls.
+// Files whose size or mtime differ are then copied by a small pool of
+// workers using the kernel's copy path: CopyFileW on Windows (which block
+// clones on ReFS/Dev Drive), and a reflink or copy_file_range on Linux with
+// a read/write fallback. The source mtime is carried over so the next
+// mirror of an unchanged file is a no-op.
+//
+// Dedup mode (Options::dedupStore) keeps one copy of each distinct file in
+// a content-addressed store, `<store>/<hh>/<hash>-<size>`, and makes every
+// mirrored file a hard link to its store object (falling back to a
+// reflink or copy where links are not possible). Mirroring the Epic and
+// Steam roots into the same store therefore keeps shared maps once. File
+// hashes are cached in `<store>/hashes.txt`, keyed on path, size and
+// mtime, so repeat mirrors only hash what changed.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace ss_mirror {
+    namespace fs = std::filesystem;
+
+    struct Options {
+        unsigned threads = 0; // copy workers; 0 = min(4, hardware threads)
+        fs::path dedupStore;  // non-empty: link into this content-addressed store
+    };
+
+    struct Stats {
+        std::size_t files = 0;     // regular files under src
+        std::size_t copied = 0;
+        std::size_t upToDate = 0;
+        std::size_t failed = 0;
+        std::uintmax_t bytesCopied = 0;
+
+        // Dedup mode only.
+        std::size_t linked = 0;        // mirrored files that are hard links into the store
+        std::size_t hashed = 0;        // files read to compute a hash
+        std::size_t hashCacheHits = 0;
+        std::uintmax_t bytesStored = 0; // new unique content added to the store
+    };
+
+    // Mirrors `src` into `dst`, creating directories as needed. Files only
+    // present in `dst` are left alone. Blocks until every copy finished.
+    Stats mirror(const fs::path& src, const fs::path& dst, const Options& opt = {});
+}
@@ -0,0 +1,175 @@
+// NameSearch.cpp
+//
+// Building does one pass over the names to fold them and emit
+// (trigram, id) pairs, then a three-pass LSD radix sort on the 24-bit
+// trigram. The sort is stable, so ids stay ascending within each posting
+// list and intersections are plain merges.
+
+#include "pch.h"
+#include "NameSearch.h"
+#include <algorithm>
+
+namespace ss_search {
+
+    namespace {
+        inline char fold(char c) { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
+
+        inline bool isWordChar(char c) {
+            return static_cast<unsigned char>(c) >= 0x80 || (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+        }
+
+        inline std::uint32_t trigram(const char* p) {
+            return (std::uint32_t(static_cast<unsigned char>(p[0])) << 16) |
+                   (std::uint32_t(static_cast<unsigned char>(p[1])) << 8) |
+                    std::uint32_t(static_cast<unsigned char>(p[2]));
+        }
+
+        // Folds and trims; interior whitespace is kept so "map 2" stays
+        // different from "map2".
+        std::string foldQuery(std::string_view q) {
+            while (!q.empty() && (q.front() == ' ' || q.front() == '\t')) q.remove_prefix(1);
+            while (!q.empty() && (q.back() == ' ' || q.back() == '\t')) q.remove_suffix(1);
+            std::string out(q);
+            for (char& c : out) c = fold(c);
+            return out;
+        }
+
+        void radixSortByTrigram(std::vector<std::uint64_t>& v) {
+            std::vector<std::uint64_t> tmp(v.size());
+            for (int shift = 32; shift < 56; shift += 8) {
+                std::size_t counts[257] = {};
+                for (std::uint64_t x : v) ++counts[((x >> shift) & 0xFF) + 1];
+                for (int b = 0; b < 256; ++b) counts[b + 1] += counts[b];
+                for (std::uint64_t x : v) tmp[counts[(x >> shift) & 0xFF]++] = x;
+                v.swap(tmp);
+            }
+        }
+    }
+
+    void NameIndex::clear() {
+        text_.clear();
+        starts_.clear();
+        words_.clear();
+        triKeys_.clear();
+        triStarts_.clear();
+        postings_.clear();
+        seen_.clear();
+        ++generation_;
+    }
+
+    void NameIndex::build(std::size_t count, const NameFn& nameAt) {
+        clear();
+        starts_.reserve(count + 1);
+        starts_.push_back(0);
+        std::vector<std::uint64_t> pairs;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::string_view name = nameAt(i);
+            const std::size_t at = text_.size();
+            for (char c : name) text_.push_back(fold(c));
+            starts_.push_back(static_cast<std::uint32_t>(text_.size()));
+
+            const char* f = text_.data() + at;
+            const std::size_t n = text_.size() - at;
+            for (std::size_t k = 0; k < n; ++k) {
+                if (isWordChar(f[k]) && (k == 0 || !isWordChar(f[k - 1])))
+                    words_.push_back({ static_cast<std::uint32_t>(i), static_cast<std::uint32_t>(k) });
+            }
+            for (std::size_t k = 0; k + 3 <= n; ++k)
+                pairs.push_back((std::uint64_t(trigram(f + k)) << 32) | i);
+        }
+
+        std::sort(words_.begin(), words_.end(), [this](const WordStart& a, const WordStart& b) {
+            if (int c = fromWord(a).compare(fromWord(b))) return c < 0;
+            return a.id < b.id;
+        });
+
+        radixSortByTrigram(pairs);
+        postings_.reserve(pairs.size());
+        std::uint64_t prev = ~std::uint64_t(0);
+        for (std::uint64_t p : pairs) {
+            if (p == prev) continue; // trigram repeated within one name
+            const std::uint32_t tri = static_cast<std::uint32_t>(p >> 32);
+            if (triKeys_.empty() || triKeys_.back() != tri) {
+                triKeys_.push_back(tri);
+                triStarts_.push_back(static_cast<std::uint32_t>(postings_.size()));
+            }
+            postings_.push_back(static_cast<std::uint32_t>(p));
+            prev = p;
+        }
+        triStarts_.push_back(static_cast<std::uint32_t>(postings_.size()));
+    }
+
+    std::pair<const std::uint32_t*, const std::uint32_t*> NameIndex::postings(std::uint32_t tri) const {
+        auto it = std::lower_bound(triKeys_.begin(), triKeys_.end(), tri);
+        if (it == triKeys_.end() || *it != tri) return { nullptr, nullptr };
+        const std::size_t k = static_cast<std::size_t>(it - triKeys_.begin());
+        return { postings_.data() + triStarts_[k], postings_.data() + triStarts_[k + 1] };
+    }
+
+    void NameIndex::search(std::string_view query, std::vector<std::uint32_t>& out) const {
+        out.clear();
+        const std::string q = foldQuery(query);
+        if (q.empty() || size() == 0) return;
+
+        if (seen_.size() != size()) seen_.assign(size(), 0);
+        if (++epoch_ == 0) { std::fill(seen_.begin(), seen_.end(), 0); epoch_ = 1; }
+
+        // 1) Names with a word starting with the query.
+        auto it = std::lower_bound(words_.begin(), words_.end(), q, [this](const WordStart& w, const std::string& key) {
+            return fromWord(w).compare(0, key.size(), key) < 0;
+        });
+        for (; it != words_.end() && fromWord(*it).compare(0, q.size(), q) == 0; ++it) {
+            if (seen_[it->id] == epoch_) continue;
+            seen_[it->id] = epoch_;
+            out.push_back(it->id);
+        }
+        if (q.size() < 3) return;
+
+        // 2) Other names containing it: intersect the posting lists of the
+        // query's trigrams, rarest first, then confirm the whole query.
+        std::vector<std::pair<const std::uint32_t*, const std::uint32_t*>> lists;
+        for (std::size_t k = 0; k + 3 <= q.size(); ++k) {
+            auto l = postings(trigram(q.data() + k));
+            if (!l.first) return;
+            lists.push_back(l);
+        }
+        std::sort(lists.begin(), lists.end(), [](const auto& a, const auto& b) {
+            return (a.second - a.first) < (b.second - b.first);
+        });
+        candidates_.assign(lists[0].first, lists[0].second);
+        for (std::size_t k = 1; k < lists.size() && !candidates_.empty(); ++k) {
+            if (lists[k] == lists[k - 1]) continue;
+            merged_.clear();
+            std::set_intersection(candidates_.begin(), candidates_.end(), lists[k].first, lists[k].second,
+                                  std::back_inserter(merged_));
+            candidates_.swap(merged_);
+        }
+        const bool exact = q.size() == 3;
+        for (std::uint32_t id : candidates_) {
+            if (seen_[id] == epoch_) continue;
+            if (!exact && folded(id).find(q) == std::string_view::npos) continue;
+            out.push_back(id);
+        }
+    }
+
+    bool Filter::update(const NameIndex& index, std::string_view query) {
+        if (generation_ == index.generation() && query == query_) return false;
+        generation_ = index.generation();
+        query_.assign(query.data(), query.size());
+        index.search(query_, ids_);
+        all_ = ids_.empty() && query_.find_first_not_of(" \t") == std::string::npos;
+        rowId_ = -1;
+        return true;
+    }
+
+    int Filter::rowOf(int id) const {
+        if (all_) return id;
+        if (id != rowId_) {
+            rowId_ = id;
+            auto it = std::find(ids_.begin(), ids_.end(), static_cast<std::uint32_t>(id));
+            row_ = it == ids_.end() ? -1 : static_cast<int>(it - ids_.begin());
+        }
+        return row_;
+    }
+
+} // namespace ss_search
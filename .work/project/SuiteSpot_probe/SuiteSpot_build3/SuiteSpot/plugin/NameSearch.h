@@ -0,0 +1,90 @@
+// NameSearch.h
+//
+// Search index over the display names behind the map pickers (RLMaps,
+// RLTraining, RLWorkshop), so typing in a searchable combo does not
+// strstr every entry each frame. Names are case-folded (ASCII) once when
+// the index is built.
+//
+// A query matches a name that contains it. Results come in two groups:
+// names with a word starting with the query, in name order (from a sorted
+// table of word starts), then the remaining names that contain it, in
+// list order (from trigram posting lists, intersected and then checked).
+// Queries shorter than three characters only match word starts.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ss_search {
+
+    class NameIndex {
+    public:
+        using NameFn = std::function<std::string_view(std::size_t)>;
+
+        // Indexes names 0..count-1 as returned by `nameAt`.
+        void build(std::size_t count, const NameFn& nameAt);
+        void clear();
+
+        std::size_t size() const { return starts_.empty() ? 0 : starts_.size() - 1; }
+        // Bumped by every build/clear, so cached results can tell they are stale.
+        std::uint64_t generation() const { return generation_; }
+
+        // Positions of the names matching `query`, best group first. An
+        // empty (or all-blank) query yields nothing; callers show the full
+        // list instead.
+        void search(std::string_view query, std::vector<std::uint32_t>& out) const;
+
+    private:
+        struct WordStart {
+            std::uint32_t id;
+            std::uint32_t offset; // into the folded name
+        };
+
+        std::string_view folded(std::uint32_t id) const {
+            return std::string_view(text_.data() + starts_[id], starts_[id + 1] - starts_[id]);
+        }
+        std::string_view fromWord(const WordStart& w) const { return folded(w.id).substr(w.offset); }
+        // Posting list for a trigram; empty if no name contains it.
+        std::pair<const std::uint32_t*, const std::uint32_t*> postings(std::uint32_t tri) const;
+
+        std::string text_;                    // folded names back to back
+        std::vector<std::uint32_t> starts_;   // text_ offset per name, plus end sentinel
+        std::vector<WordStart> words_;        // sorted by fromWord(), then id
+        std::vector<std::uint32_t> triKeys_;  // sorted distinct trigrams
+        std::vector<std::uint32_t> triStarts_; // postings_ offset per key, plus end sentinel
+        std::vector<std::uint32_t> postings_; // name ids, ascending within a trigram
+        std::uint64_t generation_ = 0;
+
+        // Scratch for search(); the index is only used from the render thread.
+        mutable std::vector<std::uint32_t> seen_;
+        mutable std::uint32_t epoch_ = 0;
+        mutable std::vector<std::uint32_t> candidates_, merged_;
+    };
+
+    // Search results for one picker, recomputed only when the query text
+    // or the index changes.
+    class Filter {
+    public:
+        // Brings the results up to date; returns true if they changed.
+        bool update(const NameIndex& index, std::string_view query);
+
+        // True while the query is blank: every name matches, in list order.
+        bool all() const { return all_; }
+        std::size_t count(const NameIndex& index) const { return all_ ? index.size() : ids_.size(); }
+        std::uint32_t idAt(std::size_t row) const { return all_ ? static_cast<std::uint32_t>(row) : ids_[row]; }
+        // Row showing name `id`, or -1 if it is filtered out.
+        int rowOf(int id) const;
+
+    private:
+        std::string query_;
+        std::uint64_t generation_ = ~std::uint64_t(0);
+        bool all_ = true;
+        std::vector<std::uint32_t> ids_;
+        mutable int rowId_ = -1, row_ = -1; // last rowOf() answer
+    };
+}
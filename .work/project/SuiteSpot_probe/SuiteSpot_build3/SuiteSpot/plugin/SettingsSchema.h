@@ -0,0 +1,187 @@
+// SettingsSchema.h
+//
+// Single description of every SuiteSpot setting. kFields lists, per
+// setting, its CVar, default, range and where it is persisted (the binary
+// snapshot in SettingsSnapshot.h, or a string key in ss_cfg). Everything
+// else is derived from it: SuiteSpot::RegisterSettings registers the CVars
+// and persistence hooks by walking the table, Values stores the current
+// values with the table's defaults and clamping, and toSnapshot /
+// fromSnapshot serialize them.
+//
+// Reads go through Values::get<Id::X>(), which is an array load typed by
+// the field's Kind; there are no string lookups on the game path.
+
+#pragma once
+
+#include "SettingsSnapshot.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+
+namespace ss_settings {
+
+    enum class Kind : std::uint8_t { Bool, Int, Text };
+    enum class Store : std::uint8_t { Snapshot, Config };
+
+    constexpr std::int32_t kNoMax = std::numeric_limits<std::int32_t>::max();
+
+    struct FieldDef {
+        const char* cvar;     // nullptr: not exposed as a CVar
+        const char* desc;
+        Kind kind;
+        Store store;
+        std::uint32_t record; // Store::Snapshot: record id
+        const char* cfgKey;   // Store::Config: ss_cfg key
+        std::int32_t def;     // Bool/Int only; Text defaults to ""
+        std::int32_t lo;
+        std::int32_t hi;      // kNoMax: unbounded
+    };
+
+    // Order must match kFields.
+    enum class Id : std::size_t {
+        Enabled,
+        AutoQueue,
+        MapType,
+        DelayQueueSec,
+        DelayFreeplaySec,
+        DelayTrainingSec,
+        DelayWorkshopSec,
+        CurrentIndex,
+        CurrentTrainingIndex,
+        CurrentWorkshopIndex,
+        MirrorDedup,
+        WorkshopPath,
+        CookedPath,
+        ImportFrom,
+        Count
+    };
+
+    constexpr FieldDef kFields[] = {
+        { "suitespot_enabled",          "Enable SuiteSpot",                   Kind::Bool, Store::Snapshot, Field::Enabled,              nullptr,         0, 0, 1 },
+        { "suitespot_autoqueue",        "Enable auto-queue",                  Kind::Bool, Store::Snapshot, Field::AutoQueue,            nullptr,         0, 0, 1 },
+        { "suitespot_map_type",         "Map type (0=Freeplay, 1=Training, 2=Workshop)",
+                                                                              Kind::Int,  Store::Snapshot, Field::MapType,              nullptr,         0, 0, 2 },
+        { "suitespot_delay_queue",      "Delay before queueing (seconds)",    Kind::Int,  Store::Snapshot, Field::DelayQueueSec,        nullptr,         0, 0, kNoMax },
+        { "suitespot_delay_freeplay",   "Delay before freeplay (seconds)",    Kind::Int,  Store::Snapshot, Field::DelayFreeplaySec,     nullptr,         0, 0, kNoMax },
+        { "suitespot_delay_training",   "Delay before training (seconds)",    Kind::Int,  Store::Snapshot, Field::DelayTrainingSec,     nullptr,         0, 0, kNoMax },
+        { "suitespot_delay_workshop",   "Delay before workshop (seconds)",    Kind::Int,  Store::Snapshot, Field::DelayWorkshopSec,     nullptr,         0, 0, kNoMax },
+        { nullptr,                      "Selected freeplay map",              Kind::Int,  Store::Snapshot, Field::CurrentIndex,         nullptr,         0, 0, kNoMax },
+        { nullptr,                      "Selected training pack",             Kind::Int,  Store::Snapshot, Field::CurrentTrainingIndex, nullptr,         0, 0, kNoMax },
+        { nullptr,                      "Selected workshop map",              Kind::Int,  Store::Snapshot, Field::CurrentWorkshopIndex, nullptr,         0, 0, kNoMax },
+        { "suitespot_mirror_dedup",     "Deduplicate mirrored workshop maps with hard links",
+                                                                              Kind::Bool, Store::Config,   0,                           "mirror_dedup",  0, 0, 1 },
+        { "suitespot_workshop_path",    "Workshop folder path",               Kind::Text, Store::Config,   0,                           "workshop_path", 0, 0, 0 },
+        { "suitespot_cooked_path",      "Epic CookedPCConsole path (TAGame\\CookedPCConsole)",
+                                                                              Kind::Text, Store::Config,   0,                           "cooked_path",   0, 0, 0 },
+        { "suitespot_import_from",      "Folder containing workshop maps to import",
+                                                                              Kind::Text, Store::Config,   0,                           "import_from",   0, 0, 0 },
+    };
+
+    constexpr std::size_t kFieldCount = sizeof(kFields) / sizeof(kFields[0]);
+    static_assert(kFieldCount == static_cast<std::size_t>(Id::Count), "kFields and Id are out of sync");
+
+    constexpr const FieldDef& def(Id id) { return kFields[static_cast<std::size_t>(id)]; }
+
+    namespace detail {
+        constexpr bool sameStr(const char* a, const char* b) {
+            if (!a || !b) return false;
+            while (*a && *a == *b) { ++a; ++b; }
+            return *a == *b;
+        }
+
+        constexpr bool schemaValid() {
+            for (std::size_t i = 0; i < kFieldCount; ++i) {
+                const FieldDef& f = kFields[i];
+                if (f.kind != Kind::Text && (f.lo > f.hi || f.def < f.lo || f.def > f.hi)) return false;
+                if (f.store == Store::Snapshot && (f.kind == Kind::Text || f.record == 0)) return false;
+                if (f.store == Store::Config && !f.cfgKey) return false;
+                for (std::size_t j = i + 1; j < kFieldCount; ++j) {
+                    const FieldDef& g = kFields[j];
+                    if (f.store == Store::Snapshot && g.store == Store::Snapshot && f.record == g.record) return false;
+                    if (sameStr(f.cfgKey, g.cfgKey) || sameStr(f.cvar, g.cvar)) return false;
+                }
+            }
+            return true;
+        }
+    }
+    static_assert(detail::schemaValid(), "settings schema: bad range, storage or duplicate key");
+
+    template <Id I>
+    using ValueT = std::conditional_t<def(I).kind == Kind::Text, std::string,
+                   std::conditional_t<def(I).kind == Kind::Bool, bool, int>>;
+
+    // Clamps a numeric value into the field's range (bools become 0/1).
+    constexpr std::int32_t clampValue(const FieldDef& f, std::int64_t v) {
+        if (f.kind == Kind::Bool) return v != 0;
+        return static_cast<std::int32_t>(std::clamp<std::int64_t>(v, f.lo, f.hi));
+    }
+
+    class Values {
+    public:
+        Values() {
+            for (std::size_t i = 0; i < kFieldCount; ++i) nums_[i] = kFields[i].def;
+        }
+
+        template <Id I>
+        ValueT<I> get() const {
+            constexpr std::size_t i = static_cast<std::size_t>(I);
+            if constexpr (def(I).kind == Kind::Text) return texts_[i];
+            else if constexpr (def(I).kind == Kind::Bool) return nums_[i] != 0;
+            else return nums_[i];
+        }
+
+        // Stores the clamped value; returns true if it changed.
+        template <Id I>
+        bool set(const ValueT<I>& v) {
+            constexpr std::size_t i = static_cast<std::size_t>(I);
+            if constexpr (def(I).kind == Kind::Text) return setText(i, v);
+            else return setNumber(i, v);
+        }
+
+        // Untyped access by table index, for code that walks kFields.
+        std::int32_t number(std::size_t i) const { return nums_[i]; }
+        const std::string& text(std::size_t i) const { return texts_[i]; }
+
+        bool setNumber(std::size_t i, std::int64_t v) {
+            const std::int32_t c = clampValue(kFields[i], v);
+            if (nums_[i] == c) return false;
+            nums_[i] = c;
+            return true;
+        }
+
+        bool setText(std::size_t i, const std::string& v) {
+            if (texts_[i] == v) return false;
+            texts_[i] = v;
+            return true;
+        }
+
+        // Field value as a CVar / ss_cfg string ("1"/"0" for bools).
+        std::string str(std::size_t i) const {
+            return kFields[i].kind == Kind::Text ? texts_[i] : std::to_string(nums_[i]);
+        }
+
+    private:
+        std::array<std::int32_t, kFieldCount> nums_{};
+        std::array<std::string, kFieldCount> texts_;
+    };
+
+    // Copies every Store::Snapshot field into `snap`, keeping other records.
+    inline void toSnapshot(const Values& v, Snapshot& snap) {
+        for (std::size_t i = 0; i < kFieldCount; ++i) {
+            if (kFields[i].store == Store::Snapshot) snap.set(kFields[i].record, v.number(i));
+        }
+    }
+
+    // Loads the Store::Snapshot fields present in `snap`, clamped; fields
+    // missing from an older file keep their current value.
+    inline void fromSnapshot(const Snapshot& snap, Values& v) {
+        for (std::size_t i = 0; i < kFieldCount; ++i) {
+            std::int32_t n;
+            if (kFields[i].store == Store::Snapshot && snap.get(kFields[i].record, n)) v.setNumber(i, n);
+        }
+    }
+}
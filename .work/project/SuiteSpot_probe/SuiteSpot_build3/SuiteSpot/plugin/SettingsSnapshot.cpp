@@ -0,0 +1,141 @@
+// SettingsSnapshot.cpp
+//
+// Reader and writer for the binary settings file described in
+// SettingsSnapshot.h. Integers are stored little-endian, which is the
+// native order on every platform BakkesMod runs on.
+
+#include "pch.h"
+#include "SettingsSnapshot.h"
+#include "ContentHash.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <system_error>
+
+namespace ss_settings {
+
+    namespace {
+        constexpr char kMagic[4] = { 'S', 'S', 'S', 'T' };
+        constexpr std::size_t kHeaderBytes = 24;
+        constexpr std::size_t kRecordBytes = 8;
+        constexpr std::uintmax_t kMaxFileBytes = 1 << 20; // far above any real snapshot
+
+        template <typename T>
+        T readLE(const unsigned char* p) { T v; std::memcpy(&v, p, sizeof(T)); return v; }
+
+        template <typename T>
+        void writeLE(std::vector<unsigned char>& out, T v) {
+            const auto* p = reinterpret_cast<const unsigned char*>(&v);
+            out.insert(out.end(), p, p + sizeof(T));
+        }
+    }
+
+    void Snapshot::set(std::uint32_t id, std::int32_t value) {
+        auto it = std::lower_bound(records_.begin(), records_.end(), id,
+            [](const auto& r, std::uint32_t key) { return r.first < key; });
+        if (it != records_.end() && it->first == id) it->second = value;
+        else records_.insert(it, { id, value });
+    }
+
+    bool Snapshot::get(std::uint32_t id, std::int32_t& out) const {
+        auto it = std::lower_bound(records_.begin(), records_.end(), id,
+            [](const auto& r, std::uint32_t key) { return r.first < key; });
+        if (it == records_.end() || it->first != id) return false;
+        out = it->second;
+        return true;
+    }
+
+    bool Snapshot::get(std::uint32_t id, bool& out) const {
+        std::int32_t v;
+        if (!get(id, v)) return false;
+        out = v != 0;
+        return true;
+    }
+
+    LoadResult load(const fs::path& file, Snapshot& out) {
+        std::error_code ec;
+        const auto size = fs::file_size(file, ec);
+        if (ec) return fs::exists(file, ec) ? LoadResult::Corrupt : LoadResult::Missing;
+        if (size < kHeaderBytes || size > kMaxFileBytes) return LoadResult::Corrupt;
+
+        std::vector<unsigned char> buf(static_cast<std::size_t>(size));
+        {
+            std::ifstream in(file, std::ios::binary);
+            if (!in.is_open()) return LoadResult::Corrupt;
+            in.read(reinterpret_cast<char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+            if (in.gcount() != static_cast<std::streamsize>(buf.size())) return LoadResult::Corrupt;
+        }
+
+        const unsigned char* p = buf.data();
+        if (std::memcmp(p, kMagic, sizeof(kMagic)) != 0) return LoadResult::Corrupt;
+        const auto version = readLE<std::uint16_t>(p + 4);
+        const auto headerBytes = readLE<std::uint16_t>(p + 6);
+        const auto count = readLE<std::uint32_t>(p + 8);
+        const auto checksum = readLE<std::uint64_t>(p + 16);
+        if (version == 0 || version > kVersion) return LoadResult::Corrupt;
+        // A larger header is allowed so later versions can extend it.
+        if (headerBytes < kHeaderBytes || headerBytes > buf.size()) return LoadResult::Corrupt;
+        if (buf.size() - headerBytes != std::size_t(count) * kRecordBytes) return LoadResult::Corrupt;
+
+        const unsigned char* recs = p + headerBytes;
+        const std::size_t recBytes = buf.size() - headerBytes;
+        if (ss_hash::hash64(recs, recBytes) != checksum) return LoadResult::Corrupt;
+
+        Snapshot snap;
+        for (std::size_t i = 0; i < count; ++i) {
+            const unsigned char* r = recs + i * kRecordBytes;
+            snap.set(readLE<std::uint32_t>(r), readLE<std::int32_t>(r + 4));
+        }
+        out = std::move(snap);
+        return LoadResult::Ok;
+    }
+
+    bool save(const fs::path& file, const Snapshot& snap) {
+        const auto& records = snap.records();
+        std::vector<unsigned char> body;
+        body.reserve(records.size() * kRecordBytes);
+        for (const auto& [id, value] : records) {
+            writeLE(body, id);
+            writeLE(body, value);
+        }
+
+        std::vector<unsigned char> buf;
+        buf.reserve(kHeaderBytes + body.size());
+        buf.insert(buf.end(), kMagic, kMagic + sizeof(kMagic));
+        writeLE(buf, kVersion);
+        writeLE(buf, static_cast<std::uint16_t>(kHeaderBytes));
+        writeLE(buf, static_cast<std::uint32_t>(records.size()));
+        writeLE(buf, std::uint32_t(0));
+        writeLE(buf, ss_hash::hash64(body.data(), body.size()));
+        buf.insert(buf.end(), body.begin(), body.end());
+
+        std::error_code ec;
+        if (file.has_parent_path()) fs::create_directories(file.parent_path(), ec);
+        fs::path tmp = file;
+        tmp += ".tmp";
+        {
+            std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) return false;
+            out.write(reinterpret_cast<const char*>(buf.data()), static_cast<std::streamsize>(buf.size()));
+            out.flush();
+            if (!out) return false;
+        }
+        fs::rename(tmp, file, ec);
+        if (ec) { fs::remove(tmp, ec); return false; }
+        return true;
+    }
+
+    bool readLegacy(const fs::path& file, Snapshot& out) {
+        std::ifstream in(file);
+        if (!in.is_open()) return false;
+        // The old loader accepted short files and left the rest at zero;
+        // keep whatever prefix is readable.
+        Snapshot snap;
+        int v = 0;
+        for (std::uint32_t id = AutoQueue; id <= CurrentWorkshopIndex && (in >> v); ++id) snap.set(id, v);
+        if (snap.empty()) return false;
+        out = std::move(snap);
+        return true;
+    }
+
+} // namespace ss_settings
@@ -0,0 +1,67 @@
+// SettingsSnapshot.h
+//
+// Binary on-disk form of SuiteSpot's UI settings. The file is a fixed
+// header followed by tagged records:
+//
+//   magic "SSST" | u16 version | u16 header bytes | u32 record count |
+//   u32 reserved | u64 xxHash64 of the records | count x { u32 id, i32 value }
+//
+// The whole file is read in one call and validated by size and checksum;
+// records are copied out directly, with no per-field parsing. Fields are
+// keyed by id rather than position, so new fields can be added without
+// breaking older files: unknown ids are kept when the snapshot is written
+// back, and ids missing from an older file leave the caller's defaults.
+
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+namespace ss_settings {
+    namespace fs = std::filesystem;
+
+    // Stable record ids. Never reuse or renumber one; append new fields.
+    enum Field : std::uint32_t {
+        AutoQueue = 1,
+        MapType = 2,
+        DelayQueueSec = 3,
+        DelayFreeplaySec = 4,
+        DelayTrainingSec = 5,
+        DelayWorkshopSec = 6,
+        CurrentIndex = 7,
+        CurrentTrainingIndex = 8,
+        CurrentWorkshopIndex = 9,
+        Enabled = 10,
+    };
+
+    constexpr std::uint16_t kVersion = 1;
+
+    class Snapshot {
+    public:
+        void set(std::uint32_t id, std::int32_t value);
+
+        // Leaves `out` untouched and returns false if `id` is absent.
+        bool get(std::uint32_t id, std::int32_t& out) const;
+        bool get(std::uint32_t id, bool& out) const;
+
+        bool empty() const { return records_.empty(); }
+        const std::vector<std::pair<std::uint32_t, std::int32_t>>& records() const { return records_; }
+
+    private:
+        std::vector<std::pair<std::uint32_t, std::int32_t>> records_; // sorted by id
+    };
+
+    enum class LoadResult { Ok, Missing, Corrupt };
+
+    // Reads and validates `file`. On anything but Ok, `out` is unchanged.
+    LoadResult load(const fs::path& file, Snapshot& out);
+
+    // Writes `snap` to a temporary sibling and renames it over `file`.
+    bool save(const fs::path& file, const Snapshot& snap);
+
+    // Reads the pre-snapshot text format (nine integers, one per line, in
+    // Field order). Returns false if the file is missing or has no values.
+    bool readLegacy(const fs::path& file, Snapshot& out);
+}
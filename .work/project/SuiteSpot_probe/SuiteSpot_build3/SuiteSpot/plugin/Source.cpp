@@ -2,98 +2,326 @@
 #include "pch.h"
 #include "SuiteSpot.h"
 #include "MapList.h"
+#include "FrameTimers.h"
+#include "FuzzyMatch.h"
+#include "NameSearch.h"
 #include <fstream>
 #include <sstream>
 
+using ss_settings::Id;
+
+namespace {
+    // Rows of an open combo popup, submitted through ImGuiListClipper so a
+    // frame costs the visible rows rather than the whole list. The clipper
+    // also submits one row past the edge while a keyboard move is pending,
+    // so arrow keys keep scrolling. On the frame the popup opens, the
+    // current row is submitted even if it is off screen, as the default
+    // focus item; ImGui then scrolls to it and starts navigation there.
+    template <typename LabelFn>
+    bool ClippedComboRows(int count, int current, int& picked, LabelFn label) {
+        bool changed = false;
+        bool currentSubmitted = false;
+        const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+        const ImVec2 top = ImGui::GetCursorPos();
+        auto row = [&](int i) {
+            ImGui::PushID(i);
+            const bool selected = (i == current);
+            if (ImGui::Selectable(label(i), selected)) { picked = i; changed = true; }
+            if (selected) { ImGui::SetItemDefaultFocus(); currentSubmitted = true; }
+            ImGui::PopID();
+        };
+
+        ImGuiListClipper clipper(count, rowHeight);
+        while (clipper.Step()) {
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) row(i);
+        }
+        if (ImGui::IsWindowAppearing() && !currentSubmitted && current >= 0 && current < count) {
+            const ImVec2 bottom = ImGui::GetCursorPos();
+            ImGui::SetCursorPos(ImVec2(top.x, top.y + rowHeight * current));
+            row(current);
+            ImGui::SetCursorPos(bottom);
+        }
+        return changed;
+    }
+
+    // State behind one searchable map picker. The name index is rebuilt
+    // while the popup is open and the list's version has moved; the
+    // filter reruns only when the query text changes.
+    //
+    // A list that keeps moving (a workshop rescan merging batches) is
+    // re-indexed at most once per kReindexSeconds, so an open popup pays
+    // for one build a second rather than one a frame. Until then the old
+    // index only lacks the newest names. A list that shrank is re-indexed
+    // at once, since the old ids may point past its end.
+    constexpr double kReindexSeconds = 1.0;
+
+    struct MapPicker {
+        char query[64] = {0};
+        ss_search::NameIndex index;
+        ss_search::Filter filter;
+        std::uint64_t indexedVersion = ~std::uint64_t(0);
+        double indexedAt = 0.0; // ImGui::GetTime() of the last build
+    };
+
+    template <typename NameFn>
+    bool SearchableMapPicker(const char* label, MapPicker& p, int count, std::uint64_t version,
+                             int current, int& picked, NameFn name) {
+        const bool valid = current >= 0 && current < count;
+        if (!ImGui::BeginSearchableCombo(label, valid ? name(current) : "<none>", p.query, IM_ARRAYSIZE(p.query), "Search...")) {
+            p.query[0] = 0; // each opening starts with the full list
+            return false;
+        }
+        const bool moved = p.indexedVersion != version || p.index.size() != (std::size_t)count;
+        const bool due = p.indexedVersion == ~std::uint64_t(0) || p.index.size() > (std::size_t)count ||
+                         ImGui::GetTime() - p.indexedAt >= kReindexSeconds;
+        if (moved && due) {
+            p.index.build(count, [&](std::size_t i) { return std::string_view(name((int)i)); });
+            p.indexedVersion = version;
+            p.indexedAt = ImGui::GetTime();
+        }
+        p.filter.update(p.index, p.query);
+
+        const int rows = (int)p.filter.count(p.index);
+        int pickedRow = -1;
+        const bool changed = ClippedComboRows(rows, valid ? p.filter.rowOf(current) : -1, pickedRow,
+                                              [&](int row) { return name((int)p.filter.idAt(row)); });
+        if (rows == 0) ImGui::TextDisabled("No maps found");
+        ImGui::EndSearchableCombo();
+        if (changed) picked = (int)p.filter.idAt(pickedRow);
+        return changed;
+    }
+
+    // Fuzzy "find any map" box over all three lists. Hits are tagged with
+    // the map type they belong to (0 freeplay, 1 training, 2 workshop).
+    struct QuickFind {
+        static constexpr std::size_t kShown = 12;
+        char query[96] = {0};
+        std::string rankedQuery;
+        ss_search::FuzzyIndex index;
+        std::vector<ss_search::FuzzyIndex::Hit> hits;
+        std::uint64_t trainingVersion = ~std::uint64_t(0);
+        std::uint64_t workshopVersion = ~std::uint64_t(0);
+        std::size_t trainingCount = 0, workshopCount = 0; // list sizes at the last build
+        double indexedAt = 0.0;
+    };
+
+    const char* QuickFindName(int type, std::uint32_t id) {
+        if (type == 0) return RLMaps[id].name.c_str();
+        if (type == 1) return RLTraining[id].name.c_str();
+        return RLWorkshop[id].name.c_str();
+    }
+
+    bool QuickFindMaps(QuickFind& q, std::uint64_t trainingVersion, std::uint64_t workshopVersion, int& type, int& id) {
+        ImGui::InputTextWithHint("Find any map", "e.g. dfh snw", q.query, IM_ARRAYSIZE(q.query));
+        if (q.query[0] == 0) { q.hits.clear(); q.rankedQuery.clear(); return false; }
+
+        // The index is only built once someone types, and rebuilt when a list
+        // moves: like the pickers, at most once per kReindexSeconds unless a
+        // list shrank under the current hits.
+        const bool moved = q.trainingVersion != trainingVersion || q.workshopVersion != workshopVersion;
+        const bool due = q.trainingVersion == ~std::uint64_t(0) || RLTraining.size() < q.trainingCount ||
+                         RLWorkshop.size() < q.workshopCount || ImGui::GetTime() - q.indexedAt >= kReindexSeconds;
+        const bool stale = moved && due;
+        if (stale) {
+            q.index.clear();
+            q.index.reserve(RLMaps.size() + RLTraining.size() + RLWorkshop.size(), 0);
+            for (std::size_t i = 0; i < RLMaps.size(); ++i) q.index.add(0, (std::uint32_t)i, RLMaps[i].name);
+            for (std::size_t i = 0; i < RLTraining.size(); ++i) q.index.add(1, (std::uint32_t)i, RLTraining[i].name);
+            for (std::size_t i = 0; i < RLWorkshop.size(); ++i) q.index.add(2, (std::uint32_t)i, RLWorkshop[i].name);
+            q.trainingVersion = trainingVersion;
+            q.workshopVersion = workshopVersion;
+            q.trainingCount = RLTraining.size();
+            q.workshopCount = RLWorkshop.size();
+            q.indexedAt = ImGui::GetTime();
+        }
+        if (stale || q.rankedQuery != q.query) {
+            q.rankedQuery = q.query;
+            q.index.rank(q.rankedQuery, QuickFind::kShown, q.hits);
+        }
+
+        static const char* kTypeTags[] = { "[Freeplay] ", "[Training] ", "[Workshop] " };
+        bool picked = false;
+        for (std::size_t i = 0; i < q.hits.size(); ++i) {
+            const auto& h = q.hits[i];
+            ImGui::PushID((int)i);
+            ImGui::TextDisabled("%s", kTypeTags[h.source]);
+            ImGui::SameLine();
+            if (ImGui::Selectable(QuickFindName(h.source, h.id))) { type = h.source; id = (int)h.id; picked = true; }
+            ImGui::PopID();
+        }
+        if (q.hits.empty()) ImGui::TextDisabled("No maps found");
+        if (picked) { q.query[0] = 0; q.hits.clear(); q.rankedQuery.clear(); }
+        return picked;
+    }
+}
+
 void SuiteSpot::RenderSettings() {
+    SS_FRAME_TIMERS_BEGIN();
     ImGui::TextUnformatted("QuickSuite Settings"); // keep user's label
-    
+
     // 1) Enable QuickSuite (checkbox)
-    CVarWrapper enableCvar = cvarManager->getCvar("suitespot_enabled");
-    if (!enableCvar) return;
-    enabled = enableCvar.getBoolValue();
-    if (ImGui::Checkbox("Enable QuickSuite", &enabled)) {
-        enableCvar.setValue(enabled);
-        SaveSettings();
+    {
+        SS_TIME_SECTION(Enable);
+        bool enabled = settings.get<Id::Enabled>();
+        if (ImGui::Checkbox("Enable QuickSuite", &enabled)) {
+            SetSetting<Id::Enabled>(enabled);
+        }
     }
 
     ImGui::Separator(); // --------------------------------
 
     // 2) Select Map Type (buttons)
-    ImGui::TextUnformatted("Select Map Type");
-    const char* mapLabels[] = {"Freeplay","Training","Workshop"};
-    for (int i=0;i<3;i++) {
-        ImGui::SameLine(i==0?0.0f:0.0f);
-        if (ImGui::RadioButton(mapLabels[i], mapType==i)) { mapType=i; SaveSettings(); }
-        if (i<2) ImGui::SameLine();
+    const int mapType = settings.get<Id::MapType>();
+    {
+        SS_TIME_SECTION(MapType);
+        ImGui::TextUnformatted("Select Map Type");
+        const char* mapLabels[] = {"Freeplay","Training","Workshop"};
+        for (int i=0;i<3;i++) {
+            ImGui::SameLine(i==0?0.0f:0.0f);
+            if (ImGui::RadioButton(mapLabels[i], mapType==i)) { SetSetting<Id::MapType>(i); }
+            if (i<2) ImGui::SameLine();
+        }
     }
 
     ImGui::Separator(); // --------------------------------
 
     // 3) Auto-Queuing Active + Delay Queue (sec)
-    if (ImGui::Checkbox("Auto-Queuing Active", &autoQueue)) {
-        SaveSettings();
-    }
-    ImGui::SetNextItemWidth(220);
-    if (ImGui::InputInt("Delay Queue (sec)", &delayQueueSec)) {
-        delayQueueSec = std::max(0, delayQueueSec);
-        SaveSettings();
+    {
+        SS_TIME_SECTION(Queue);
+        bool autoQueue = settings.get<Id::AutoQueue>();
+        if (ImGui::Checkbox("Auto-Queuing Active", &autoQueue)) {
+            SetSetting<Id::AutoQueue>(autoQueue);
+        }
+        ImGui::SetNextItemWidth(220);
+        int delayQueueSec = settings.get<Id::DelayQueueSec>();
+        if (ImGui::InputInt("Delay Queue (sec)", &delayQueueSec)) {
+            SetSetting<Id::DelayQueueSec>(delayQueueSec); // clamped by the schema
+        }
     }
 
     ImGui::Separator(); // --------------------------------
 
-    // 4) Training Packs / Workshop maps dropdown (interchangeable based on map type)
-    if (mapType == 1) {
-        if (ImGui::BeginCombo("Training Packs", (RLTraining.empty()?"<none>":RLTraining[currentTrainingIndex].name.c_str()))) {
-            for (int i=0;i<(int)RLTraining.size();++i) {
-                bool selected = (i==currentTrainingIndex);
-                if (ImGui::Selectable(RLTraining[i].name.c_str(), selected)) { currentTrainingIndex = i; SaveSettings(); }
+    // 4) Freeplay / Training Packs / Workshop maps dropdown (interchangeable based on map type),
+    //    with a fuzzy search across all three above it
+    {
+        SS_TIME_SECTION(Combos);
+        static QuickFind quickFind;
+        {
+            int foundType = 0, foundId = 0;
+            bool found;
+            {
+                // The training and workshop lists change on the game thread.
+                std::scoped_lock lk(trainingMutex, workshopScanMutex);
+                found = QuickFindMaps(quickFind, trainingListVersion, workshopListVersion, foundType, foundId);
             }
-            ImGui::EndCombo();
-        }
-        ImGui::SameLine();
-        bool _ss_shuffle = trainingShuffleEnabled;
-        if (ImGui::Checkbox("Auto-Shuffle##train", &_ss_shuffle)) { trainingShuffleEnabled = _ss_shuffle; if (trainingShuffleEnabled) { BuildTrainingShuffleBag(); } }
-        static char newMapCode[64] = {0};
-        static char newMapName[64] = {0};
-        ImGui::InputText("Training Map Code", newMapCode, IM_ARRAYSIZE(newMapCode));
-        ImGui::InputText("Training Map Name", newMapName, IM_ARRAYSIZE(newMapName));
-        if (ImGui::Button("Add Training Map")) {
-            if (strlen(newMapCode) > 0 && strlen(newMapName) > 0) {
-                RLTraining.push_back({ std::string(newMapCode), std::string(newMapName) });
-                // replaced by persistent storage
-                SaveTrainingMaps();
-                // legacy file write removed
-                
-                newMapCode[0] = 0; newMapName[0] = 0;
+            if (found) {
+                SetSetting<Id::MapType>(foundType);
+                if (foundType == 0) SetSetting<Id::CurrentIndex>(foundId);
+                else if (foundType == 1) SetSetting<Id::CurrentTrainingIndex>(foundId);
+                else SetSetting<Id::CurrentWorkshopIndex>(foundId);
             }
         }
-    
-    } else if (mapType == 2) {
-        if (ImGui::BeginCombo("Workshop Maps", (RLWorkshop.empty()?"<none>":RLWorkshop[currentWorkshopIndex].name.c_str()))) {
-            for (int i=0;i<(int)RLWorkshop.size();++i) {
-                bool selected = (i==currentWorkshopIndex);
-                if (ImGui::Selectable(RLWorkshop[i].name.c_str(), selected)) { currentWorkshopIndex = i; SaveSettings(); }
-                if (selected) ImGui::SetItemDefaultFocus();
+        static MapPicker freeplayPicker, trainingPicker, workshopPicker;
+        if (mapType == 0) {
+            int picked = -1;
+            if (SearchableMapPicker("Freeplay Maps", freeplayPicker, (int)RLMaps.size(), 0,
+                                    settings.get<Id::CurrentIndex>(), picked,
+                                    [](int i) { return RLMaps[i].name.c_str(); })) {
+                SetSetting<Id::CurrentIndex>(picked);
+            }
+        } else if (mapType == 1) {
+            // Console notifiers edit the list on the game thread.
+            std::lock_guard<std::mutex> lk(trainingMutex);
+            const int currentTrainingIndex = settings.get<Id::CurrentTrainingIndex>();
+            const bool trValid = currentTrainingIndex >= 0 && currentTrainingIndex < (int)RLTraining.size();
+            int picked = -1;
+            if (SearchableMapPicker("Training Packs", trainingPicker, (int)RLTraining.size(), trainingListVersion,
+                                    currentTrainingIndex, picked,
+                                    [](int i) { return RLTraining[i].name.c_str(); })) {
+                SetSetting<Id::CurrentTrainingIndex>(picked);
+            }
+            ImGui::SameLine();
+            bool _ss_shuffle = trainingShuffleEnabled;
+            if (ImGui::Checkbox("Auto-Shuffle##train", &_ss_shuffle)) { trainingShuffleEnabled = _ss_shuffle; if (trainingShuffleEnabled) { BuildTrainingShuffleBag(); } }
+            ImGui::SameLine();
+            if (ImGui::Button("Remove##train") && trValid) { RemoveTrainingMap(currentTrainingIndex); }
+            static char newMapCode[64] = {0};
+            static char newMapName[64] = {0};
+            static std::string addStatus;
+            ImGui::InputText("Training Map Code", newMapCode, IM_ARRAYSIZE(newMapCode));
+            ImGui::InputText("Training Map Name", newMapName, IM_ARRAYSIZE(newMapName));
+            if (ImGui::Button("Add Training Map")) {
+                if (strlen(newMapCode) > 0 && strlen(newMapName) > 0) {
+                    const auto [idx, added] = trainingIndex.add(RLTraining, { std::string(newMapCode), std::string(newMapName) });
+                    if (added) {
+                        AppendTrainingMap(RLTraining[idx]);
+                        if (trainingShuffleEnabled) BuildTrainingShuffleBag();
+                        addStatus.clear();
+                        newMapCode[0] = 0; newMapName[0] = 0;
+                    } else if (idx >= 0) {
+                        // Already in the list: point at it instead of adding a copy.
+                        SetSetting<Id::CurrentTrainingIndex>(idx);
+                        addStatus = "Already added as \"" + RLTraining[idx].name + "\"";
+                    } else {
+                        addStatus = "Code needs letters or digits";
+                    }
+                }
+            }
+            if (!addStatus.empty()) { ImGui::SameLine(); ImGui::TextUnformatted(addStatus.c_str()); }
+
+        } else if (mapType == 2) {
+            const int currentWorkshopIndex = settings.get<Id::CurrentWorkshopIndex>();
+            int picked = -1;
+            bool cancelScan = false, rescan = false;
+            {
+                // RLWorkshop is merged on the game thread.
+                std::lock_guard<std::mutex> lk(workshopScanMutex);
+                if (!SearchableMapPicker("Workshop Maps", workshopPicker, (int)RLWorkshop.size(), workshopListVersion,
+                                         currentWorkshopIndex, picked,
+                                         [](int i) { return RLWorkshop[i].name.c_str(); })) {
+                    picked = -1;
+                }
+                ImGui::SameLine();
+                if (workshopScanRunning) {
+                    // Scan runs in the background; the list above fills in as it goes.
+                    cancelScan = ImGui::Button("Cancel##ws");
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("(%d found, scanning...)", (int)RLWorkshop.size());
+                } else {
+                    rescan = ImGui::Button("Rescan##ws");
+                    ImGui::SameLine();
+                    ImGui::TextDisabled("(%d found)", (int)RLWorkshop.size());
+                }
             }
-            ImGui::EndCombo();
+            if (picked >= 0) SetSetting<Id::CurrentWorkshopIndex>(picked);
+            // Scans are started and stopped on the game thread only.
+            if (cancelScan) RunOnGameThread([this] { CancelWorkshopScan(); DrainWorkshopScan(); });
+            if (rescan) RunOnGameThread([this] { LoadWorkshopMaps(); SaveSettings(); });
+            // Display path hint
+            ImGui::TextWrapped("Workshop maps are discovered from Epic/Steam mods folders (recursive).");
         }
-        ImGui::SameLine();
-        if (ImGui::Button("Rescan##ws")) { LoadWorkshopMaps(); SaveSettings(); }
-        ImGui::SameLine();
-        ImGui::TextDisabled("(%d found)", (int)RLWorkshop.size());
-        // Display path hint
-        ImGui::TextWrapped("Workshop maps are discovered from Epic/Steam mods folders (recursive).");
     }
 
-
     ImGui::Separator(); // --------------------------------
 
-    // 5) Delays per mode
-    ImGui::SetNextItemWidth(220);
-    if (ImGui::InputInt("Delay Freeplay (sec)", &delayFreeplaySec)) { delayFreeplaySec = std::max(0, delayFreeplaySec); SaveSettings(); }
-    ImGui::SetNextItemWidth(220);
-    if (ImGui::InputInt("Delay Training (sec)", &delayTrainingSec)) { delayTrainingSec = std::max(0, delayTrainingSec); SaveSettings(); }
-    ImGui::SetNextItemWidth(220);
-    if (ImGui::InputInt("Delay Workshop (sec)", &delayWorkshopSec)) { delayWorkshopSec = std::max(0, delayWorkshopSec); SaveSettings(); }
+    // 5) Delays per mode (clamped by the schema)
+    {
+        SS_TIME_SECTION(Delays);
+        int delay = settings.get<Id::DelayFreeplaySec>();
+        ImGui::SetNextItemWidth(220);
+        if (ImGui::InputInt("Delay Freeplay (sec)", &delay)) { SetSetting<Id::DelayFreeplaySec>(delay); }
+        delay = settings.get<Id::DelayTrainingSec>();
+        ImGui::SetNextItemWidth(220);
+        if (ImGui::InputInt("Delay Training (sec)", &delay)) { SetSetting<Id::DelayTrainingSec>(delay); }
+        delay = settings.get<Id::DelayWorkshopSec>();
+        ImGui::SetNextItemWidth(220);
+        if (ImGui::InputInt("Delay Workshop (sec)", &delay)) { SetSetting<Id::DelayWorkshopSec>(delay); }
+    }
+
+#if SUITESPOT_FRAME_TIMERS
+    ImGui::Separator(); // --------------------------------
+    static bool showFrameTimers = false;
+    ImGui::Checkbox("Show frame timers", &showFrameTimers);
+    if (showFrameTimers) ss_perf::drawOverlay(&showFrameTimers);
+#endif
 }
@@ -1,182 +1,19 @@
 #include <filesystem>
+#include <fstream>
 #include <cstdlib>            // for std::getenv and system
 #include <system_error>       // for std::error_code
 #include "SuiteSpotConfig.h" // configuration helpers
-
-
-namespace ss_paths {
-    namespace fs = std::filesystem;
-
-    inline fs::path epicModsDefault() {
-        const char* up = std::getenv("USERPROFILE");
-        if (!up) return {};
-        return fs::path(up) / "Documents" / "My Games" / "Rocket League" / "TAGame" / "CookedPCConsole" / "mods";
-    }
-
-    inline fs::path steamWorkshopDefault() {
-        const char* sp = std::getenv("PROGRAMFILES(X86)");
-        if (!sp) return {};
-        fs::path base = fs::path(sp) / "Steam" / "steamapps" / "workshop" / "content" / "252950";
-        if (fs::exists(base)) return base;
-        return {};
-    }
-
-    inline fs::path bmDataRoot() {
-        const char* app = std::getenv("APPDATA");
-        if (!app) return {};
-        return fs::path(app) / "bakkesmod" / "bakkesmod" / "data";
-    }
-
-    inline fs::path suiteTrainingDir()  { return bmDataRoot() / "SuiteTraining"; }
-    inline fs::path suiteWorkshopsDir() { return bmDataRoot() / "SuiteWorkshops"; }
-
-    inline void ensureDataDirs(std::error_code& ec) {
-        fs::create_directories(suiteTrainingDir(),  ec);
-        ec.clear();
-        fs::create_directories(suiteWorkshopsDir(), ec);
-    }
-}
-
-// Helper functions for handling Epic/Steam workshop maps and cooked content.
-// These functions are designed to avoid reliance on WorkshopMapLoader and do
-// not probe the user's Documents folder. Instead, they prioritise the
-// BakkesMod data directories and standard Steam workshop paths.
-namespace ss_epic {
-    namespace fs = std::filesystem;
-
-    // Returns true if the given path exists and is a directory.
-    inline bool exists_dir(const fs::path& p) {
-        std::error_code ec;
-        return fs::exists(p, ec) && fs::is_directory(p, ec);
-    }
-
-    // Determines whether a file path has an extension that looks like a
-    // workshop map (upk, udk, pak, zip). Extensions are compared case-
-    // insensitively.
-    inline bool looksLikeMapFile(const fs::path& p) {
-        auto ext = p.extension().string();
-        for (auto& c : ext) c = (char)tolower((unsigned char)c);
-        return ext == ".udk" || ext == ".upk" || ext == ".pak" || ext == ".zip";
-    }
-
-    // Returns true if the directory contains at least one map file directly or
-    // within its immediate children (one level deep). This avoids scanning
-    // deeply nested directories but is sufficient for our auto-detection.
-    inline bool looksLikeMapDir(const fs::path& p) {
-        std::error_code ec;
-        if (!exists_dir(p)) return false;
-        // Check files in current directory
-        for (auto& e : fs::directory_iterator(p, ec)) {
-            if (ec) { ec.clear(); continue; }
-            if (e.is_regular_file(ec) && looksLikeMapFile(e.path())) return true;
-        }
-        // Check immediate subdirectories
-        for (auto& e : fs::directory_iterator(p, ec)) {
-            if (ec) { ec.clear(); continue; }
-            if (!e.is_directory(ec)) continue;
-            for (auto& f : fs::directory_iterator(e.path(), ec)) {
-                if (ec) { ec.clear(); continue; }
-                if (f.is_regular_file(ec) && looksLikeMapFile(f.path())) return true;
-            }
-        }
-        return false;
-    }
-
-    // Build a list of candidate directories where workshop maps may reside.
-    // The order is: SuiteSpot's own data folders, generic 'Workshop' folder
-    // within BakkesMod data, and Steam workshop content for Rocket League.
-    inline std::vector<fs::path> candidateFolders() {
-        std::vector<fs::path> cand;
-        const char* app = std::getenv("APPDATA");
-        if (app) {
-            fs::path dataRoot = fs::path(app) / "bakkesmod" / "bakkesmod" / "data";
-            cand.push_back(dataRoot / "SuiteWorkshops");
-            cand.push_back(dataRoot / "Workshop");
-        }
-        const char* pf86 = std::getenv("PROGRAMFILES(X86)");
-        if (pf86) {
-            fs::path base = fs::path(pf86) / "Steam" / "steamapps" / "workshop" / "content" / "252950";
-            cand.push_back(base);
-            // Attempt to parse additional Steam library folders from libraryfolders.vdf
-            fs::path vdf = fs::path(pf86) / "Steam" / "steamapps" / "libraryfolders.vdf";
-            std::error_code ec;
-            if (fs::exists(vdf, ec) && fs::is_regular_file(vdf, ec)) {
-                std::ifstream in(vdf.string());
-                std::string line;
-                while (std::getline(in, line)) {
-                    auto pos = line.find("\"path\"");
-                    if (pos == std::string::npos) continue;
-                    auto q1 = line.find('"', pos + 6);
-                    if (q1 == std::string::npos) continue;
-                    auto q2 = line.find('"', q1 + 1);
-                    if (q2 == std::string::npos) continue;
-                    std::string p = line.substr(q1 + 1, q2 - (q1 + 1));
-                    fs::path lib = fs::path(p) / "steamapps" / "workshop" / "content" / "252950";
-                    cand.push_back(lib);
-                }
-            }
-        }
-        return cand;
-    }
-
-    // Attempt to detect a workshop root directory by iterating candidate
-    // directories. If a directory contains recognizable map files, it is
-    // returned. If none match, an empty path is returned.
-    inline fs::path detectWorkshopRoot() {
-        for (const auto& c : candidateFolders()) {
-            std::error_code ec;
-            if (looksLikeMapDir(c)) return c;
-        }
-        return {};
-    }
-
-    // Check if essential cooked texture files exist in the cooked folder. This
-    // matches the file list typically used by WorkshopMapLoader to determine
-    // whether textures are installed. The list is intentionally conservative.
-    inline bool texturesInstalled(const fs::path& cooked) {
-        static const char* required[] = {
-            "mods.upk",
-            "Engine_MI_Shaders.upk",
-            "EngineBuildings.upk",
-            "EngineDebugMaterials.upk",
-            "MapTemplates.upk",
-            "MapTemplateIndex.upk",
-            "NodeBuddies.upk"
-        };
-        for (auto* file : required) {
-            if (!exists_dir(cooked)) return false;
-            std::error_code ec;
-            if (!fs::exists(cooked / file, ec)) return false;
-        }
-        return true;
-    }
-
-    // Expand a zip archive into the destination directory using PowerShell. The
-    // -Force flag overwrites existing files. This helper spawns a shell via
-    // system() and therefore blocks until completion. It assumes
-    // powershell.exe is available on the system.
-    inline void ps_expand_zip(const std::string& zipPath, const fs::path& dest) {
-        // Ensure destination directory exists
-        std::error_code ec;
-        fs::create_directories(dest, ec);
-        // Build and execute the PowerShell command
-        std::string cmd = std::string("powershell.exe -NoProfile -ExecutionPolicy Bypass -Command \"") +
-                          "Expand-Archive -LiteralPath '" + zipPath + "' -DestinationPath '" + dest.string() + "' -Force\"";
-        std::system(cmd.c_str());
-    }
-
-    // Download a file from a URL using PowerShell Invoke-WebRequest and save
-    // it to the specified output file. Returns true on success. If PowerShell
-    // fails for any reason, false is returned. Note: this function relies on
-    // an outbound connection and may fail silently if network access is not
-    // available.
-    inline bool ps_download_to(const std::string& url, const std::string& outFile) {
-        std::string cmd = std::string("powershell.exe -NoProfile -ExecutionPolicy Bypass -Command \"") +
-                          "Invoke-WebRequest -Uri '" + url + "' -OutFile '" + outFile + "' -UseBasicParsing\"";
-        int code = std::system(cmd.c_str());
-        return code == 0;
-    }
-} // namespace ss_epic
+#include "WorkshopHelpers.h" // ss_paths / ss_epic workshop detection
+#include "WorkshopWalker.h"  // parallel directory discovery
+#include "WorkshopCatalog.h" // sorted RLWorkshop maintenance
+#include "TrainingCsv.h"     // SuiteSpotTrainingMaps.txt reader/writer
+#include "TrainingImport.h"  // bulk pack import
+#include "TrainingJournal.h" // append-only add/remove log
+#include "MappedFile.h"      // memory-mapped import source
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
 
 
 #include "pch.h"
@@ -188,6 +25,8 @@ namespace ss_epic {
 #include <random>
 #include <utility>
 
+using ss_settings::Id;
+
 // ===== SuiteSpot persistence helpers =====
 std::filesystem::path SuiteSpot::GetDataRoot() const {
     const char* appdata = std::getenv("APPDATA");
@@ -197,9 +36,12 @@ std::filesystem::path SuiteSpot::GetDataRoot() const {
 std::filesystem::path SuiteSpot::GetSuiteTrainingDir() const { return GetDataRoot() / "SuiteTraining"; }
 std::filesystem::path SuiteSpot::GetSuiteWorkshopsDir() const { return GetDataRoot() / "SuiteWorkshops"; }
 std::filesystem::path SuiteSpot::GetTrainingFilePath() const { return GetSuiteTrainingDir() / "SuiteSpotTrainingMaps.txt"; }
+std::filesystem::path SuiteSpot::GetTrainingJournalPath() const { return GetSuiteTrainingDir() / "SuiteSpotTrainingMaps.journal"; }
 std::filesystem::path SuiteSpot::GetWorkshopFilePath() const { return GetSuiteWorkshopsDir() / "(mirror-only/no-manifest)"; }
+std::filesystem::path SuiteSpot::GetWorkshopIndexPath() const { return GetSuiteWorkshopsDir() / "SuiteSpotWorkshopIndex.txt"; }
+std::filesystem::path SuiteSpot::GetSettingsPath() const { return GetDataRoot() / "SuiteSpot" / "suitespot_settings.bin"; }
 
-void SuiteSpot::EnsureDataDirectories() const const {
+void SuiteSpot::EnsureDataDirectories() const {
     std::error_code ec;
     auto root = GetDataRoot();
     if (!root.empty()) std::filesystem::create_directories(root, ec);
@@ -210,66 +52,102 @@ void SuiteSpot::EnsureDataDirectories() const const {
 void SuiteSpot::LoadTrainingMaps() {
     EnsureDataDirectories();
     EnsureReadmeFiles();
+    std::lock_guard<std::mutex> lk(trainingMutex);
     RLTraining.clear();
+    trainingIndex.clear();
+    ++trainingListVersion;
+    trainingJournal.open(GetTrainingJournalPath());
     auto f = GetTrainingFilePath();
-    std::error_code ec;
-    if (!std::filesystem::exists(f, ec)) return;
-    std::ifstream in(f.string());
-    if (!in.is_open()) return;
-    std::string line;
-    while (std::getline(in, line)) {
-        if (line.empty()) continue;
-        auto pos = line.find(',');
-        if (pos == std::string::npos) continue;
-        std::string code = line.substr(0, pos);
-        std::string name = line.substr(pos+1);
-        if (!code.empty() && !name.empty()) RLTraining.push_back({ code, name });
+    ss_training::ParseResult parsed;
+    if (ss_training::load(f, parsed)) {
+        RLTraining = std::move(parsed.entries);
+        trainingIndex = std::move(parsed.index);
     }
-}
 
-void SuiteSpot::SaveTrainingMaps() const {
-    auto f = GetTrainingFilePath();
-    EnsureDataDirectories();
-    EnsureReadmeFiles();
-    std::ofstream out(f.string(), std::ios::trunc);
-    if (!out.is_open()) return;
-    for (const auto& e : RLTraining) out << e.code << "," << e.name << "\n";
+    if (!parsed.issues.empty()) {
+        constexpr std::size_t kMaxReported = 10;
+        for (std::size_t i = 0; i < parsed.issues.size() && i < kMaxReported; ++i) {
+            LOG_WARN(cvarManager, f.filename().string() + ":" + std::to_string(parsed.issues[i].line) +
+                ": " + parsed.issues[i].reason);
+        }
+        LOG_WARN(cvarManager, "Training maps: " + std::to_string(RLTraining.size()) + " loaded, " +
+            std::to_string(parsed.issues.size() - parsed.duplicates) + " malformed lines, " +
+            std::to_string(parsed.duplicates) + " duplicate codes skipped");
+    }
+
+    // Changes made since the list was last written (including before a
+    // crash) live in the journal; apply them and fold them into the list.
+    const auto replayed = ss_training::replay(GetTrainingJournalPath(), RLTraining, trainingIndex);
+    if (replayed.records > 0 || replayed.torn) {
+        LOG_INFO(cvarManager, "Training journal: " + std::to_string(replayed.records) + " records, +" +
+            std::to_string(replayed.added) + " / -" + std::to_string(replayed.removed) + " packs" +
+            (replayed.torn ? ", incomplete tail dropped" : ""));
+        SaveTrainingMaps();
+    }
 }
 
+int SuiteSpot::FindTrainingMap(std::string_view code) const {
+    return trainingIndex.find(code);
+}
 
+void SuiteSpot::SaveTrainingMaps() {
+    auto f = GetTrainingFilePath();
+    auto tmp = f;
+    tmp += ".tmp";
+    const std::string text = ss_training::serialize(RLTraining);
+    {
+        std::ofstream out(tmp, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            // The folder may have been removed since load.
+            EnsureDataDirectories();
+            out.open(tmp, std::ios::binary | std::ios::trunc);
+            if (!out.is_open()) return;
+        }
+        out.write(text.data(), static_cast<std::streamsize>(text.size()));
+        if (!out) return;
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp, f, ec);
+    if (ec) {
+        std::filesystem::remove(tmp, ec);
+        return;
+    }
+    // Only now is every journalled change in the list file.
+    trainingJournal.reset();
+}
 
+void SuiteSpot::AppendTrainingMap(const TrainingEntry& e) {
+    // Past this many records, replay on load costs more than one rewrite.
+    constexpr std::size_t kCompactAfter = 256;
+    ++trainingListVersion;
+    if (!trainingJournal.append(ss_training::JournalOp::Add, e) || trainingJournal.records() >= kCompactAfter) {
+        SaveTrainingMaps();
+    }
+}
 
+bool SuiteSpot::RemoveTrainingMap(int index) {
+    if (index < 0 || index >= (int)RLTraining.size()) return false;
+    const TrainingEntry removed = RLTraining[index];
+    ss_training::removeAt(RLTraining, trainingIndex, static_cast<std::size_t>(index));
+    ++trainingListVersion;
 
+    const int current = settings.get<Id::CurrentTrainingIndex>();
+    if (current > index || current >= (int)RLTraining.size()) {
+        SetSetting<Id::CurrentTrainingIndex>(std::max(0, current - 1));
+    }
+    if (trainingShuffleEnabled) BuildTrainingShuffleBag();
 
+    if (!trainingJournal.append(ss_training::JournalOp::Remove, removed)) SaveTrainingMaps();
+    return true;
+}
 
-// Mirror src directory recursively into dst
-void SuiteSpot::MirrorDirectory(const std::filesystem::path& src, const std::filesystem::path& dst) const {
-    std::error_code ec;
-    if (!std::filesystem::exists(src, ec) || !std::filesystem::is_directory(src, ec)) return;
-    std::filesystem::create_directories(dst, ec);
-    for (auto const& entry : std::filesystem::recursive_directory_iterator(src, ec)) {
-        if (ec) { ec.clear(); continue; }
-        auto rel = std::filesystem::relative(entry.path(), src, ec);
-        if (ec) { ec.clear(); continue; }
-        auto target = dst / rel;
-        if (entry.is_directory()) {
-            std::filesystem::create_directories(target, ec);
-        } else if (entry.is_regular_file()) {
-            // copy if missing or different timestamp/size
-            bool copyNeeded = true;
-            if (std::filesystem::exists(target, ec)) {
-                auto src_time = std::filesystem::last_write_time(entry.path(), ec);
-                auto dst_time = std::filesystem::last_write_time(target, ec);
-                auto src_size = std::filesystem::file_size(entry.path(), ec);
-                auto dst_size = std::filesystem::file_size(target, ec);
-                copyNeeded = (src_time != dst_time) || (src_size != dst_size);
-            }
-            if (copyNeeded) {
-                std::filesystem::create_directories(target.parent_path(), ec);
-                std::filesystem::copy_file(entry.path(), target, std::filesystem::copy_options::overwrite_existing, ec);
-            }
-        }
-    }
+// Mirror src directory recursively into dst (see MirrorEngine.h). With
+// suitespot_mirror_dedup on, files become hard links into a shared
+// content-addressed store under SuiteWorkshops.
+ss_mirror::Stats SuiteSpot::MirrorDirectory(const std::filesystem::path& src, const std::filesystem::path& dst) const {
+    ss_mirror::Options opt;
+    if (settings.get<Id::MirrorDedup>()) opt.dedupStore = GetSuiteWorkshopsDir() / ".store";
+    return ss_mirror::mirror(src, dst, opt);
 }
 
 void SuiteSpot::EnsureReadmeFiles() const {
@@ -280,7 +158,9 @@ void SuiteSpot::EnsureReadmeFiles() const {
         o << "SuiteTraining\\SuiteSpotTrainingMaps.txt\n"
              "CSV format:\n"
              "    <training_code>,<display_name>\n"
-             "One entry per line. This file is read on game start and updated when you add a map in SuiteSpot.\n";
+             "One entry per line. Quote a name that contains commas: CODE,\"Name, with comma\"\n"
+             "Repeated codes keep the first entry. This file is read on game start and updated when you add a map in SuiteSpot.\n"
+             "To add a whole list, run suitespot_import_training <file> (or with no argument, to read the clipboard).\n";
     }
     // SuiteWorkshops README
     auto wr = GetSuiteWorkshopsDir() / "README.txt";
@@ -289,30 +169,39 @@ void SuiteSpot::EnsureReadmeFiles() const {
         o << "SuiteWorkshops is a mirrored copy of your Rocket League 'mods' folder.\n"
              "Origin (Epic): C:\\Program Files\\Epic Games\\rocketleague\\TAGame\\CookedPCConsole\\mods\n"
              "On game start, SuiteSpot mirrors that folder here for persistence and indexing.\n"
-             "Do not edit map files here unless you know what you're doing.\n";
+             "Do not edit map files here unless you know what you're doing.\n"
+             "SuiteSpotWorkshopIndex.txt caches scan results; delete it to force a full rescan.\n";
     }
 }
 
 
-void SuiteSpot::DiscoverWorkshopInDir(const std::filesystem::path& dir) {
+void SuiteSpot::DiscoverWorkshopInDir(const std::filesystem::path& dir, std::vector<WorkshopEntry>& out) const {
+    namespace fs = std::filesystem;
     std::error_code ec;
-    if (!std::filesystem::exists(dir, ec) || !std::filesystem::is_directory(dir, ec)) return;
-    for (const auto& entry : std::filesystem::directory_iterator(dir, ec)) {
-        if (ec) { ec.clear(); continue; }
-        if (entry.is_directory()) {
-            bool found = false;
-            for (const auto& f : std::filesystem::directory_iterator(entry.path(), ec)) {
-                if (ec) { ec.clear(); continue; }
-                if (f.is_regular_file() && f.path().extension() == ".upk") {
-                    RLWorkshop.push_back({ f.path().string(), entry.path().filename().string() });
-                    found = true;
-                    break;
-                }
-            }
-        } else if (entry.is_regular_file() && entry.path().extension() == ".upk") {
-            RLWorkshop.push_back({ entry.path().string(), entry.path().stem().string() });
+    if (!fs::exists(dir, ec) || !fs::is_directory(dir, ec)) return;
+
+    // Top-level .upk files use their stem; each immediate subfolder
+    // contributes its first .upk under the folder name. Subfolders are
+    // listed in parallel, then merged into the sorted catalog.
+    std::mutex m;
+    std::vector<WorkshopEntry> found;
+    ss_walk::ScanSpec spec;
+    spec.match = ss_walk::ExtensionSet{ ".upk" };
+    spec.maxDepth = 1;
+    ss_walk::scan({ dir }, spec, [&](ss_walk::Listing& l) {
+        if (l.files.empty()) return true;
+        std::lock_guard<std::mutex> lk(m);
+        if (l.depth == 0) {
+            for (const auto& f : l.files) found.push_back({ f.path().string(), f.path().stem().string() });
+        } else {
+            // Listing order is the platform's, same as the old "first hit".
+            found.push_back({ l.files.front().path().string(), l.dir.path().filename().string() });
         }
-    }
+        return true;
+    });
+
+    ss_catalog::assignKeys(found);
+    ss_catalog::insertSorted(out, std::move(found));
 }
 
 
@@ -325,69 +214,226 @@ using namespace std;
 using namespace std::filesystem;
 
 
-void SuiteSpot::LoadWorkshopMaps()
+// Roots for Epic + Steam (we scan recursively)
+std::vector<std::filesystem::path> SuiteSpot::GetWorkshopRoots() const
 {
-    RLWorkshop.clear();
-
-    namespace fs = std::filesystem;
-    std::error_code ec;
-
-    // Roots for Epic + Steam (we scan recursively)
-    const std::vector<fs::path> roots = {
-        fs::path{R"(C:\Program Files\Epic Games\rocketleague\TAGame\CookedPCConsole\mods)"},
-        fs::path{R"(C:\Program Files (x86)\Steam\steamapps\workshop\content\252950)"}
+    return {
+        std::filesystem::path{R"(C:\Program Files\Epic Games\rocketleague\TAGame\CookedPCConsole\mods)"},
+        std::filesystem::path{R"(C:\Program Files (x86)\Steam\steamapps\workshop\content\252950)"}
     };
+}
 
-    auto readJsonTitle = [](const fs::path& jsonPath) -> std::string {
-        std::ifstream in(jsonPath);
-        if (!in.is_open()) return {};
-        std::string s((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
-        auto t = s.find("\"title\"");
-        if (t == std::string::npos) return {};
-        t = s.find(':', t); if (t == std::string::npos) return {};
-        t = s.find('"', t); if (t == std::string::npos) return {};
-        auto e = s.find('"', t + 1); if (e == std::string::npos) return {};
-        return s.substr(t + 1, e - (t + 1));
-    };
+void SuiteSpot::LoadWorkshopMaps()
+{
+    const auto roots = GetWorkshopRoots();
+
+    CancelWorkshopScan();
 
-    for (const auto& root : roots)
     {
-        if (!fs::exists(root, ec) || ec) { ec.clear(); continue; }
+        std::lock_guard<std::mutex> lk(workshopScanMutex);
+        // Remember the selection by path so it survives re-sorting while
+        // batches arrive; with nothing selected yet the saved index is kept.
+        workshopScanKeepPath.clear();
+        const int currentWorkshopIndex = settings.get<Id::CurrentWorkshopIndex>();
+        if (currentWorkshopIndex >= 0 && currentWorkshopIndex < (int)RLWorkshop.size())
+            workshopScanKeepPath = RLWorkshop[currentWorkshopIndex].filePath;
+        RLWorkshop.clear();
+        ++workshopListVersion;
+        workshopScanPending.clear();
+        workshopWatchAdded.clear();
+        workshopWatchRemoved.clear();
+        workshopWatchRescan = false;
+    }
 
-        for (fs::recursive_directory_iterator it(root, ec), end; it != end; ++it) {
-            if (ec) { ec.clear(); continue; }
-            if (!it->is_regular_file(ec)) { if (ec) ec.clear(); continue; }
-
-            const fs::path p = it->path();
-            if (p.extension() != ".upk") continue;
-
-            WorkshopEntry w;
-            w.filePath = p.string(); // full path saved
-            std::string stem = p.stem().string();
-
-            // Pretty name: json title > parent folder > stem
-            std::string display = stem;
-            fs::path parent = p.parent_path().filename();
-            if (!parent.empty()) display = parent.string();
-            fs::path jsonPath = p.parent_path() / (stem + ".json");
-            if (fs::exists(jsonPath, ec) && !ec) {
-                auto t = readJsonTitle(jsonPath);
-                if (!t.empty()) display = t;
+    EnsureDataDirectories();
+    const auto indexPath = GetWorkshopIndexPath();
+    workshopScanCancel = false;
+    workshopScanDone = false;
+    workshopScanRunning = true;
+
+    // Only directories whose mtime changed since the last scan are re-listed;
+    // everything else (including resolved titles) comes from the index.
+    workshopScanThread = std::thread([this, roots, indexPath] {
+        if (!workshopIndex.isLoaded()) workshopIndex.load(indexPath);
+        ss_walk::counters().reset();
+        bool complete = workshopIndex.scan(roots, [this](std::vector<WorkshopEntry>&& batch) {
+            ss_catalog::assignKeys(batch);
+            {
+                std::lock_guard<std::mutex> lk(workshopScanMutex);
+                workshopScanPending.insert(workshopScanPending.end(),
+                    std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+            }
+            ScheduleWorkshopDrain();
+        }, &workshopScanCancel);
+        if (complete) workshopIndex.save();
+        workshopScanComplete = complete;
+        workshopScanRunning = false;
+        workshopScanDone = true;
+        ScheduleWorkshopDrain();
+    });
+}
+
+// Keeps RLWorkshop current between rescans. Each debounced burst from the
+// watcher is turned into one delta (entries to drop, entries to add) on the
+// watcher thread; DrainWorkshopScan applies it with a single merge on the
+// game thread.
+void SuiteSpot::StartWorkshopWatcher()
+{
+    namespace fs = std::filesystem;
+    workshopWatcher.start(GetWorkshopRoots(), [this](ss_watch::ChangeSet&& cs) {
+        // Same case-insensitive matching as the scan, so Map.UPK is followed too.
+        static const ss_walk::ExtensionSet kMap{ ".upk" };
+        static const ss_walk::ExtensionSet kSidecar{ ".json" };
+        // The map a sidecar titles: same stem, extension in any case.
+        auto mapFor = [](const fs::path& json) {
+            std::error_code ec;
+            for (fs::directory_iterator it(json.parent_path(), ec), end; !ec && it != end; it.increment(ec)) {
+                const fs::path& f = it->path();
+                if (f.stem() == json.stem() && kMap.matches(f)) return f;
             }
-            w.name = display;
-            RLWorkshop.push_back(std::move(w));
+            return fs::path();
+        };
+
+        // Maps whose entry must be rebuilt: changed maps, plus maps whose
+        // sidecar was written or deleted (the title changes either way).
+        std::vector<fs::path> touched;
+        std::vector<std::string> removed;
+        for (const auto& p : cs.removed) {
+            if (kSidecar.matches(p)) touched.push_back(mapFor(p));
+            else removed.push_back(p.string());
+        }
+        for (const auto& p : cs.upserted) {
+            if (kSidecar.matches(p)) touched.push_back(mapFor(p));
+            else if (kMap.matches(p)) touched.push_back(p);
         }
-    }
 
-    std::sort(RLWorkshop.begin(), RLWorkshop.end(),
-              [](const WorkshopEntry& a, const WorkshopEntry& b){ return a.name < b.name; });
+        std::vector<WorkshopEntry> added;
+        std::unordered_set<std::string> seen;
+        for (const auto& map : touched) {
+            std::error_code ec;
+            if (map.empty() || !fs::is_regular_file(map, ec) || !seen.insert(map.string()).second) continue;
+            // Replace rather than duplicate entries that were modified in place.
+            removed.push_back(map.string());
+            added.push_back({ map.string(), ss_index::resolveDisplayName(map) });
+        }
+        ss_catalog::assignKeys(added);
+
+        {
+            std::lock_guard<std::mutex> lk(workshopScanMutex);
+            if (cs.overflow) workshopWatchRescan = true;
+            workshopWatchRemoved.insert(workshopWatchRemoved.end(), removed.begin(), removed.end());
+            workshopWatchAdded.insert(workshopWatchAdded.end(),
+                std::make_move_iterator(added.begin()), std::make_move_iterator(added.end()));
+        }
+        ScheduleWorkshopDrain();
+    });
+}
 
-    currentWorkshopIndex = std::clamp(currentWorkshopIndex, 0, (int)RLWorkshop.size() - 1);
+void SuiteSpot::RunOnGameThread(std::function<void()> fn)
+{
+    gameWrapper->Execute([alive = std::weak_ptr<bool>(aliveToken), fn = std::move(fn)](GameWrapper*) {
+        if (alive.lock()) fn();
+    });
 }
 
-    // Nice to have: sort alphabetically
-    std::sort(RLWorkshop.begin(), RLWorkshop.end(),
-              [](const WorkshopEntry& a, const WorkshopEntry& b){ return a.name < b.name; });
+// At most one drain is queued at a time; batches that arrive before it
+// runs are merged by it too.
+void SuiteSpot::ScheduleWorkshopDrain()
+{
+    if (workshopDrainQueued.exchange(true)) return;
+    RunOnGameThread([this] {
+        workshopDrainQueued = false;
+        DrainWorkshopScan();
+    });
+}
+
+void SuiteSpot::CancelWorkshopScan()
+{
+    workshopScanCancel = true;
+    if (workshopScanThread.joinable()) workshopScanThread.join();
+}
+
+void SuiteSpot::DrainWorkshopScan()
+{
+    std::unique_lock<std::mutex> lk(workshopScanMutex);
+    int currentWorkshopIndex = settings.get<Id::CurrentWorkshopIndex>();
+
+    // Watcher deltas. While a full scan is running they cannot be merged
+    // safely (the scan may or may not have seen the change yet), so they
+    // just queue a follow-up incremental rescan instead.
+    const bool haveDelta = !workshopWatchAdded.empty() || !workshopWatchRemoved.empty();
+    if (haveDelta && workshopScanRunning) {
+        workshopWatchRescan = true;
+        workshopWatchAdded.clear();
+        workshopWatchRemoved.clear();
+    } else if (haveDelta) {
+        std::string keep;
+        if (currentWorkshopIndex >= 0 && currentWorkshopIndex < (int)RLWorkshop.size())
+            keep = RLWorkshop[currentWorkshopIndex].filePath;
+
+        // A removed path may be a file or a whole directory; match the entry
+        // itself or any of its parent folders.
+        std::unordered_set<std::string> gone(workshopWatchRemoved.begin(), workshopWatchRemoved.end());
+        RLWorkshop.erase(std::remove_if(RLWorkshop.begin(), RLWorkshop.end(), [&](const WorkshopEntry& w) {
+            for (std::filesystem::path p = w.filePath; !p.empty() && p != p.parent_path(); p = p.parent_path())
+                if (gone.count(p.string())) return true;
+            return false;
+        }), RLWorkshop.end());
+
+        LOG_INFO(cvarManager, "Workshop folders changed: +" + std::to_string(workshopWatchAdded.size()) +
+            " / -" + std::to_string(workshopWatchRemoved.size()) + " paths");
+        ss_catalog::insertSorted(RLWorkshop, std::move(workshopWatchAdded));
+        ++workshopListVersion;
+        workshopWatchAdded.clear();
+        workshopWatchRemoved.clear();
+
+        auto it = std::find_if(RLWorkshop.begin(), RLWorkshop.end(),
+                               [&](const WorkshopEntry& w) { return w.filePath == keep; });
+        if (it != RLWorkshop.end()) currentWorkshopIndex = (int)(it - RLWorkshop.begin());
+        currentWorkshopIndex = std::clamp(currentWorkshopIndex, 0, std::max(0, (int)RLWorkshop.size() - 1));
+    }
+
+    if (!workshopScanPending.empty()) {
+        // Follow whatever is selected right now, including picks made mid-scan.
+        if (currentWorkshopIndex >= 0 && currentWorkshopIndex < (int)RLWorkshop.size())
+            workshopScanKeepPath = RLWorkshop[currentWorkshopIndex].filePath;
+
+        std::vector<WorkshopEntry> batch;
+        batch.swap(workshopScanPending);
+        ss_catalog::insertSorted(RLWorkshop, std::move(batch));
+        ++workshopListVersion;
+
+        if (!workshopScanKeepPath.empty()) {
+            auto it = std::find_if(RLWorkshop.begin(), RLWorkshop.end(),
+                                   [&](const WorkshopEntry& w) { return w.filePath == workshopScanKeepPath; });
+            if (it != RLWorkshop.end()) currentWorkshopIndex = (int)(it - RLWorkshop.begin());
+        }
+    }
+
+    if (workshopScanDone.exchange(false)) {
+        if (workshopScanComplete) {
+            const auto& st = workshopIndex.lastStats();
+            LOG_INFO(cvarManager, "Workshop scan: " + std::to_string(RLWorkshop.size()) + " maps, " +
+                std::to_string(st.dirsRelisted) + "/" + std::to_string(st.dirsVisited) + " dirs relisted, " +
+                std::to_string(st.titleHits) + " cache hits, " + std::to_string(st.titleMisses) + " misses");
+            const auto& io = ss_walk::counters();
+            LOG_INFO(cvarManager, "Workshop scan I/O: " + std::to_string(io.dirsListed.load()) + " dirs listed, " +
+                std::to_string(io.entriesSeen.load()) + " entries, " + std::to_string(io.stats.load()) + " stats");
+        } else {
+            LOG_INFO(cvarManager, "Workshop scan cancelled after " + std::to_string(RLWorkshop.size()) + " maps");
+        }
+        workshopScanKeepPath.clear();
+        currentWorkshopIndex = std::clamp(currentWorkshopIndex, 0, std::max(0, (int)RLWorkshop.size() - 1));
+    }
+    settings.set<Id::CurrentWorkshopIndex>(currentWorkshopIndex);
+
+    // Lost watcher events, or changes that raced a scan: the index makes a
+    // follow-up rescan cheap since only the touched directories are relisted.
+    if (workshopWatchRescan && !workshopScanRunning) {
+        workshopWatchRescan = false;
+        lk.unlock();
+        LoadWorkshopMaps();
+    }
 }
 
 
@@ -398,35 +444,115 @@ BAKKESMOD_PLUGIN(SuiteSpot, "SuiteSpot", plugin_version, PLUGINTYPE_FREEPLAY)
 
 shared_ptr<CVarManagerWrapper> _globalCvarManager;
 
+// Settings live in a versioned binary snapshot (SettingsSnapshot.h). The
+// pre-snapshot build wrote nine integers to this file in the working
+// directory; it is migrated once and then renamed out of the way.
+static const char* kLegacySettingsFile = "suitespot_settings.cfg";
+
 void SuiteSpot::SaveSettings() {
-    std::ofstream file("suitespot_settings.cfg");
-    if (!file.is_open()) return;
-    file << (autoQueue ? 1 : 0) << "\n";
-    file << mapType << "\n";
-    file << delayQueueSec << "\n";
-    file << delayFreeplaySec << "\n";
-    file << delayTrainingSec << "\n";
-    file << delayWorkshopSec << "\n";
-    file << currentIndex << "\n";
-    file << currentTrainingIndex << "\n";
-    file << currentWorkshopIndex << "\n";
-    file.close();
+    ss_settings::Snapshot snap = settingsSnapshot;
+    ss_settings::toSnapshot(settings, snap);
+    settingsSnapshot = snap;
+    settingsWriter.request([path = GetSettingsPath(), snap = std::move(snap)] {
+        return ss_settings::save(path, snap);
+    });
 }
 
 void SuiteSpot::LoadSettings() {
-    std::ifstream file("suitespot_settings.cfg");
-    if (!file.is_open()) return;
-    int aq=0, mt=0, dq=0, df=0, dt=0, dw=0, ci=0, cti=0, cwi=0;
-    file >> aq >> mt >> dq >> df >> dt >> dw >> ci >> cti >> cwi;
-    autoQueue = aq!=0;
-    mapType = mt;
-    delayQueueSec = dq;
-    delayFreeplaySec = df;
-    delayTrainingSec = dt;
-    delayWorkshopSec = dw;
-    currentIndex = ci;
-    currentTrainingIndex = cti;
-    currentWorkshopIndex = cwi;
+    using namespace ss_settings;
+    const auto path = GetSettingsPath();
+    Snapshot snap;
+    bool migrated = false;
+    switch (load(path, snap)) {
+    case LoadResult::Ok:
+        break;
+    case LoadResult::Missing:
+        migrated = readLegacy(kLegacySettingsFile, snap);
+        break;
+    case LoadResult::Corrupt:
+        LOG_WARN(cvarManager, "Settings file is damaged; using defaults: " + path.string());
+        break;
+    }
+
+    // Builds before the snapshot kept Enabled only in BakkesMod's own
+    // config, so a migrated (or missing) snapshot has no record of it;
+    // take the value BakkesMod restored into the CVar instead.
+    bool enabled = false;
+    const auto& enabledCvar = settingCvars[static_cast<std::size_t>(Id::Enabled)];
+    if (!snap.get(Field::Enabled, enabled) && enabledCvar && !enabledCvar->IsNull()) {
+        snap.set(Field::Enabled, enabledCvar->getBoolValue() ? 1 : 0);
+    }
+
+    fromSnapshot(snap, settings);
+    for (std::size_t i = 0; i < kFieldCount; ++i) {
+        if (kFields[i].store == Store::Snapshot) PushSettingCvar(i);
+    }
+    settingsSnapshot = std::move(snap);
+
+    if (migrated) {
+        if (save(path, settingsSnapshot)) {
+            std::error_code ec;
+            std::filesystem::rename(kLegacySettingsFile, std::string(kLegacySettingsFile) + ".migrated", ec);
+            LOG_INFO(cvarManager, "Migrated settings to " + path.string());
+        } else {
+            LOG_WARN(cvarManager, "Could not write settings snapshot: " + path.string());
+        }
+    }
+}
+
+// Registers one CVar per schema field that has one, wired so console or
+// BakkesMod changes land in `settings` and are persisted, keeping each
+// handle in settingCvars; then loads the ss_cfg-backed fields.
+// Snapshot-backed fields are loaded by LoadSettings.
+void SuiteSpot::RegisterSettings() {
+    using namespace ss_settings;
+    for (std::size_t i = 0; i < kFieldCount; ++i) {
+        const FieldDef& f = kFields[i];
+        if (!f.cvar) continue;
+        const bool ranged = f.kind != Kind::Text;
+        // Values are persisted by SuiteSpot itself, so BakkesMod's config is
+        // not asked to save them too (it would restore stale values on load).
+        // suitespot_enabled stays in BakkesMod's config for one more release:
+        // older builds kept it only there, and LoadSettings seeds the
+        // snapshot from it.
+        const bool saveToCfg = static_cast<Id>(i) == Id::Enabled;
+        CVarWrapper cvar = cvarManager->registerCvar(f.cvar, settings.str(i), f.desc, true,
+                                                     ranged, static_cast<float>(f.lo),
+                                                     ranged && f.hi != kNoMax, static_cast<float>(f.hi), saveToCfg);
+        cvar.addOnValueChanged([this, i](std::string, CVarWrapper c) {
+            const bool changed = kFields[i].kind == Kind::Text ? settings.setText(i, c.getStringValue())
+                                                               : settings.setNumber(i, c.getIntValue());
+            if (changed) OnSettingChanged(i);
+        });
+        settingCvars[i].emplace(cvar);
+    }
+
+    for (std::size_t i = 0; i < kFieldCount; ++i) {
+        const FieldDef& f = kFields[i];
+        if (f.store != Store::Config) continue;
+        const std::string v = ss_cfg::read(f.cfgKey);
+        if (v.empty()) continue;
+        if (f.kind == Kind::Text) settings.setText(i, v);
+        else settings.setNumber(i, std::atoi(v.c_str()));
+        PushSettingCvar(i);
+    }
+}
+
+// Mirrors a field into its CVar through the handle cached at
+// registration. The CVar's change hook then sees an unchanged value and
+// stops there.
+void SuiteSpot::PushSettingCvar(std::size_t field) {
+    if (!settingCvars[field] || settingCvars[field]->IsNull()) return;
+    CVarWrapper& c = *settingCvars[field];
+    if (ss_settings::kFields[field].kind == ss_settings::Kind::Text) c.setValue(settings.text(field));
+    else c.setValue(settings.number(field));
+}
+
+void SuiteSpot::OnSettingChanged(std::size_t field) {
+    PushSettingCvar(field);
+    const auto& f = ss_settings::kFields[field];
+    if (f.store == ss_settings::Store::Config) ss_cfg::write(f.cfgKey, settings.str(field));
+    else SaveSettings();
 }
 
 void SuiteSpot::LoadHooks() {
@@ -436,7 +562,8 @@ void SuiteSpot::LoadHooks() {
 }
 
 void SuiteSpot::GameEndedEvent(std::string name) {
-    if (!enabled) return;
+    if (!settings.get<Id::Enabled>()) return;
+    const int mapType = settings.get<Id::MapType>();
 
     auto safeExecute = [&](int delaySec, const std::string& cmd) {
         if (delaySec <= 0) {
@@ -448,84 +575,59 @@ void SuiteSpot::GameEndedEvent(std::string name) {
 
     // Dispatch based on mapType
     if (mapType == 0) { // Freeplay
+        const int currentIndex = settings.get<Id::CurrentIndex>();
         if (currentIndex < 0 || currentIndex >= (int)RLMaps.size()) {
             LOG("SuiteSpot: Freeplay index out of range; skipping load.");
         } else {
-            safeExecute(delayFreeplaySec, "load_freeplay " + RLMaps[currentIndex].code);
+            safeExecute(settings.get<Id::DelayFreeplaySec>(), "load_freeplay " + RLMaps[currentIndex].code);
             LOG("SuiteSpot: Loading freeplay map: " + RLMaps[currentIndex].name);
         }
     } else if (mapType == 1) { // Training
+        std::lock_guard<std::mutex> lk(trainingMutex);
         if (RLTraining.empty()) {
             LOG("SuiteSpot: No training maps configured.");
         } else {
             // Clamp or choose from shuffle
+            int currentTrainingIndex;
             if (trainingShuffleEnabled) {
                 currentTrainingIndex = NextTrainingIndex();
             } else {
-                currentTrainingIndex = std::clamp(currentTrainingIndex, 0, (int)RLTraining.size()-1);
+                currentTrainingIndex = std::clamp(settings.get<Id::CurrentTrainingIndex>(), 0, (int)RLTraining.size()-1);
             }
-            safeExecute(delayTrainingSec, "load_training " + RLTraining[currentTrainingIndex].code);
+            settings.set<Id::CurrentTrainingIndex>(currentTrainingIndex);
+            safeExecute(settings.get<Id::DelayTrainingSec>(), "load_training " + RLTraining[currentTrainingIndex].code);
             LOG("SuiteSpot: Loading training map: " + RLTraining[currentTrainingIndex].name);
         }
     } else if (mapType == 2) { // Workshop
-        if (RLWorkshop.empty()) {
+        DrainWorkshopScan(); // anything not merged yet
+        // The settings page reads RLWorkshop under workshopScanMutex on
+        // the render thread; copy the one entry we need.
+        std::optional<WorkshopEntry> pick;
+        {
+            std::lock_guard<std::mutex> lk(workshopScanMutex);
+            if (!RLWorkshop.empty()) {
+                const int currentWorkshopIndex = std::clamp(settings.get<Id::CurrentWorkshopIndex>(), 0, (int)RLWorkshop.size()-1);
+                settings.set<Id::CurrentWorkshopIndex>(currentWorkshopIndex);
+                pick = RLWorkshop[currentWorkshopIndex];
+            }
+        }
+        if (!pick) {
             LOG("SuiteSpot: No workshop maps configured.");
         } else {
-            currentWorkshopIndex = std::clamp(currentWorkshopIndex, 0, (int)RLWorkshop.size()-1);
-            safeExecute(delayWorkshopSec, "load_workshop \"" + RLWorkshop[currentWorkshopIndex].filePath + "\"");
-            LOG("SuiteSpot: Loading workshop map: " + RLWorkshop[currentWorkshopIndex].name);
+            safeExecute(settings.get<Id::DelayWorkshopSec>(), "load_workshop \"" + pick->filePath + "\"");
+            LOG("SuiteSpot: Loading workshop map: " + pick->name);
         }
     }
 
-    if (autoQueue) {
-        safeExecute(delayQueueSec, "queue");
+    if (settings.get<Id::AutoQueue>()) {
+        safeExecute(settings.get<Id::DelayQueueSec>(), "queue");
         LOG("SuiteSpot: Auto-Queuing triggered.");
     }
 }
 
 void SuiteSpot::onLoad() {
 // Register SuiteSpot CVars and notifiers
-    cvarManager->registerCvar("suitespot_autoqueue", "0", "Enable auto-queue", true, true, 0, true, 1);
-    cvarManager->registerCvar("suitespot_delay_freeplay", "2", "Delay before freeplay (seconds)");
-    cvarManager->registerCvar("suitespot_delay_training", "2", "Delay before training (seconds)");
-    cvarManager->registerCvar("suitespot_delay_workshop", "2", "Delay before workshop (seconds)");
-    // Workshop folder path used when selecting maps manually. If left blank,
-    // detection will attempt to locate a suitable directory on demand.
-    cvarManager->registerCvar("suitespot_workshop_path", "", "Workshop folder path")
-        .addOnValueChanged([this](std::string, CVarWrapper c) {
-            // Persist workshop path to configuration whenever it changes
-            ss_cfg::write("workshop_path", c.getStringValue());
-        });
-
-    // Path to the Epic cooked content directory (TAGame\CookedPCConsole). Users
-    // should set this if they wish to download workshop textures or import maps
-    // for Epic versions of Rocket League.
-    cvarManager->registerCvar("suitespot_cooked_path", "", "Epic CookedPCConsole path (TAGame\\CookedPCConsole)")
-        .addOnValueChanged([this](std::string, CVarWrapper c) {
-            ss_cfg::write("cooked_path", c.getStringValue());
-        });
-
-    // Folder containing workshop maps to import into the cooked folder. When
-    // populated, clicking the import button will copy or unpack maps from
-    // this folder into the cooked directory.
-    cvarManager->registerCvar("suitespot_import_from", "", "Folder containing workshop maps to import")
-        .addOnValueChanged([this](std::string, CVarWrapper c) {
-            ss_cfg::write("import_from", c.getStringValue());
-        });
-
-    // Read persisted configuration values and populate CVars accordingly. This
-    // ensures that user preferences survive between game sessions. If a key
-    // is missing from the config file, the corresponding CVar retains its
-    // default empty value.
-    {
-        std::string v;
-        v = ss_cfg::read("workshop_path");
-        if (!v.empty()) cvarManager->getCvar("suitespot_workshop_path").setValue(v);
-        v = ss_cfg::read("cooked_path");
-        if (!v.empty()) cvarManager->getCvar("suitespot_cooked_path").setValue(v);
-        v = ss_cfg::read("import_from");
-        if (!v.empty()) cvarManager->getCvar("suitespot_import_from").setValue(v);
-    }
+    RegisterSettings();
 
     cvarManager->registerNotifier("suitespot_refresh_maps", [this](std::vector<std::string>) {
     std::error_code ec;
@@ -535,12 +637,12 @@ void SuiteSpot::onLoad() {
 }, "Refresh SuiteSpot maps", PERMISSION_ALL);
 
     cvarManager->registerNotifier("suitespot_open_workshop", [this](std::vector<std::string>) {
-        auto path = cvarManager->getCvar("suitespot_workshop_path").getStringValue();
+        auto path = settings.get<Id::WorkshopPath>();
         // If no path is set, attempt to detect one from common locations
         if (path.empty()) {
             std::filesystem::path p = ss_epic::detectWorkshopRoot();
             if (!p.empty()) {
-                cvarManager->getCvar("suitespot_workshop_path").setValue(p.string());
+                SetSetting<Id::WorkshopPath>(p.string());
                 path = p.string();
             }
         }
@@ -558,7 +660,7 @@ void SuiteSpot::onLoad() {
     // pointing to the configured directory. If the path is empty or not a
     // directory, a warning is logged instead.
     cvarManager->registerNotifier("suitespot_open_cooked", [this](std::vector<std::string>) {
-        auto cooked = cvarManager->getCvar("suitespot_cooked_path").getStringValue();
+        auto cooked = settings.get<Id::CookedPath>();
         if (!cooked.empty() && ss_epic::exists_dir(cooked)) {
             std::string cmd = "start \"\" \"" + cooked + "\"";
             std::system(cmd.c_str());
@@ -573,7 +675,7 @@ void SuiteSpot::onLoad() {
     // directory. This operation may take some time and requires network
     // connectivity. The URL is hard-coded; adjust if necessary.
     cvarManager->registerNotifier("suitespot_download_textures", [this](std::vector<std::string>) {
-        auto cooked = cvarManager->getCvar("suitespot_cooked_path").getStringValue();
+        auto cooked = settings.get<Id::CookedPath>();
         if (cooked.empty() || !ss_epic::exists_dir(cooked)) {
             LOG_ERR(cvarManager, "CookedPCConsole path not set or invalid.");
             return;
@@ -599,11 +701,91 @@ void SuiteSpot::onLoad() {
         }
     }, "Download & Install Workshop Textures", PERMISSION_ALL);
 
+    // Notifier: report how many settings writes were coalesced away.
+    cvarManager->registerNotifier("suitespot_io_stats", [this](std::vector<std::string>) {
+        LOG_INFO(cvarManager, "Settings writes: requested " + std::to_string(settingsWriter.requested()) +
+            ", performed " + std::to_string(settingsWriter.performed()));
+        LOG_INFO(cvarManager, "Config writes: requested " + std::to_string(ss_cfg::writesRequested()) +
+            ", performed " + std::to_string(ss_cfg::writesPerformed()));
+    }, "Show settings write-behind counters", PERMISSION_ALL);
+
+    // Notifier: select a training pack by code (dashes and case ignored).
+    cvarManager->registerNotifier("suitespot_select_training", [this](std::vector<std::string> args) {
+        if (args.size() < 2) {
+            LOG_WARN(cvarManager, "Usage: suitespot_select_training <code>");
+            return;
+        }
+        std::lock_guard<std::mutex> lk(trainingMutex);
+        const int idx = FindTrainingMap(args[1]);
+        if (idx < 0) {
+            LOG_WARN(cvarManager, "No training pack with code " + args[1]);
+            return;
+        }
+        SetSetting<Id::CurrentTrainingIndex>(idx);
+        LOG_INFO(cvarManager, "Selected training pack: " + RLTraining[idx].name);
+    }, "Select a training pack by its code", PERMISSION_ALL);
+
+    // Notifier: remove a training pack by code.
+    cvarManager->registerNotifier("suitespot_remove_training", [this](std::vector<std::string> args) {
+        if (args.size() < 2) {
+            LOG_WARN(cvarManager, "Usage: suitespot_remove_training <code>");
+            return;
+        }
+        std::lock_guard<std::mutex> lk(trainingMutex);
+        const int idx = FindTrainingMap(args[1]);
+        if (idx < 0) {
+            LOG_WARN(cvarManager, "No training pack with code " + args[1]);
+            return;
+        }
+        const std::string name = RLTraining[idx].name;
+        RemoveTrainingMap(idx);
+        LOG_INFO(cvarManager, "Removed training pack: " + name);
+    }, "Remove a training pack by its code", PERMISSION_ALL);
+
+    // Notifier: add many training packs at once from a file or the
+    // clipboard, saving the list once at the end.
+    cvarManager->registerNotifier("suitespot_import_training", [this](std::vector<std::string> args) {
+        std::string text;
+        std::string source = "clipboard";
+        if (args.size() >= 2 && args[1] != "clipboard") {
+            source = args[1];
+            ss_io::MappedFile map;
+            if (!map.open(std::filesystem::u8path(source))) {
+                LOG_ERR(cvarManager, "Cannot open " + source);
+                return;
+            }
+            text.assign(map.view());
+        } else {
+            text = ss_training::readClipboardText();
+        }
+        if (text.empty()) {
+            LOG_WARN(cvarManager, "Nothing to import from " + source);
+            return;
+        }
+
+        ss_training::ImportResult r;
+        {
+            std::lock_guard<std::mutex> lk(trainingMutex);
+            r = ss_training::importPacks(text, RLTraining, trainingIndex);
+            if (r.added > 0) {
+                ++trainingListVersion;
+                SaveTrainingMaps();
+                if (trainingShuffleEnabled) BuildTrainingShuffleBag();
+            }
+        }
+        LOG_INFO(cvarManager, "Training import from " + source + ": " + std::to_string(r.added) + " added, " +
+            std::to_string(r.known) + " already known, " + std::to_string(r.badCodes) + " invalid codes, " +
+            std::to_string(r.malformed) + " malformed lines");
+        for (const auto& code : r.samples) {
+            LOG_WARN(cvarManager, "Not a XXXX-XXXX-XXXX-XXXX pack code: " + code);
+        }
+    }, "Import training packs (code,name per line) from a file path or the clipboard", PERMISSION_ALL);
+
     // Notifier: import workshop maps from a folder into the cooked directory.
     // Files with .udk/.upk/.pak are copied; .zip archives are extracted.
     cvarManager->registerNotifier("suitespot_import_now", [this](std::vector<std::string>) {
-        auto src = cvarManager->getCvar("suitespot_import_from").getStringValue();
-        auto cooked = cvarManager->getCvar("suitespot_cooked_path").getStringValue();
+        auto src = settings.get<Id::ImportFrom>();
+        auto cooked = settings.get<Id::CookedPath>();
         if (src.empty()) {
             LOG_WARN(cvarManager, "Import path not set.");
             return;
@@ -649,19 +831,25 @@ void SuiteSpot::onLoad() {
     EnsureReadmeFiles();
     LoadTrainingMaps();
     LoadWorkshopMaps();
+    StartWorkshopWatcher();
     LoadHooks();
 
-    // Expose one enable cvar to integrate with BakkesMod settings
-    cvarManager->registerCvar("suitespot_enabled", "0", "Enable SuiteSpot", true, true, 0, true, 1)
-        .addOnValueChanged([this](string oldValue, CVarWrapper cvar) {
-            enabled = cvar.getBoolValue();
-        });
     // Store training maps string for persistence compatibility
     cvarManager->registerCvar("ss_training_maps", "", "Stored training maps", true, false, 0, false, 0);
 }
 
 void SuiteSpot::onUnload() {
+    workshopWatcher.stop();
+    CancelWorkshopScan();
+    aliveToken.reset(); // both threads that queue game-thread work are gone
     SaveSettings();
+    settingsWriter.stop();
+    ss_cfg::shutdown();
+    {
+        std::lock_guard<std::mutex> lk(trainingMutex);
+        if (trainingJournal.records() > 0) SaveTrainingMaps();
+        trainingJournal.close();
+    }
     LOG("SuiteSpot unloaded");
 }
 
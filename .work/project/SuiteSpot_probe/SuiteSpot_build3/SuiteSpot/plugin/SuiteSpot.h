@@ -6,8 +6,21 @@
 #include "bakkesmod/plugin/pluginwindow.h"
 #include "bakkesmod/plugin/PluginSettingsWindow.h"
 #include "MapList.h"
+#include "MirrorEngine.h"
+#include "SettingsSchema.h"
+#include "TrainingCatalog.h"
+#include "TrainingJournal.h"
+#include "WorkshopIndex.h"
+#include "WorkshopWatcher.h"
+#include "WriteBehind.h"
 #include "version.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
 #include <vector>
 
 // External helpers
@@ -32,16 +45,30 @@ public:
     std::filesystem::path GetSuiteTrainingDir() const;
     std::filesystem::path GetSuiteWorkshopsDir() const;
     std::filesystem::path GetTrainingFilePath() const;   // SuiteTraining\SuiteSpotTrainingMaps.txt
+    std::filesystem::path GetTrainingJournalPath() const; // SuiteTraining\SuiteSpotTrainingMaps.journal
     std::filesystem::path GetWorkshopFilePath() const;   // SuiteWorkshops\SuiteSpotWorkshopMaps.txt
+    std::filesystem::path GetWorkshopIndexPath() const;  // SuiteWorkshops\SuiteSpotWorkshopIndex.txt
+    std::filesystem::path GetSettingsPath() const;       // SuiteSpot\suitespot_settings.bin
 
-    // Persistence API
+    // Persistence API. Apart from LoadTrainingMaps, the training calls
+    // expect the caller to hold trainingMutex.
     void LoadTrainingMaps();
-    void SaveTrainingMaps() const;
-    void LoadWorkshopMaps();        // extends previous disk-scan to also read/write file
+    void SaveTrainingMaps();        // rewrites the list file and empties the journal
+    void AppendTrainingMap(const TrainingEntry& e);  // journals one add (RLTraining already updated)
+    bool RemoveTrainingMap(int index);               // removes, journals and fixes up indices
+    int  FindTrainingMap(std::string_view code) const; // index into RLTraining, or -1
+    void LoadWorkshopMaps();        // starts a background rescan; results arrive via DrainWorkshopScan
+    void CancelWorkshopScan();      // stops a running rescan and waits for its thread
+    void DrainWorkshopScan();       // merges scanned batches and watcher deltas into RLWorkshop (game thread)
+    void ScheduleWorkshopDrain();   // queues one DrainWorkshopScan on the game thread; any thread
+    void StartWorkshopWatcher();    // follows changes under the workshop roots between rescans
+    std::vector<std::filesystem::path> GetWorkshopRoots() const;
     void SaveWorkshopMaps() const; // no-op (legacy)
-    void DiscoverWorkshopInDir(const std::filesystem::path& dir);
+    // Merges the maps found directly in `dir` into the sorted `out`. To
+    // feed RLWorkshop, hold workshopScanMutex and bump workshopListVersion.
+    void DiscoverWorkshopInDir(const std::filesystem::path& dir, std::vector<WorkshopEntry>& out) const;
 // File/dir utilities
-void MirrorDirectory(const std::filesystem::path& src, const std::filesystem::path& dst) const;
+ss_mirror::Stats MirrorDirectory(const std::filesystem::path& src, const std::filesystem::path& dst) const;
 void EnsureReadmeFiles() const;
 
     // lifecycle
@@ -58,25 +85,39 @@ void EnsureReadmeFiles() const;
     // persistence
     void SaveSettings();
     void LoadSettings();
+    void RegisterSettings();        // CVars and ss_cfg values for every SettingsSchema field
+
+    // Stores a setting, then syncs its CVar and persists it if it changed.
+    template <ss_settings::Id I>
+    void SetSetting(const ss_settings::ValueT<I>& v) {
+        if (settings.set<I>(v)) OnSettingChanged(static_cast<std::size_t>(I));
+    }
 
     // workshop discovery (needed because SuiteSpot.cpp calls it)
 // (removed duplicate)
 
 private:
     // state (one definition only)
-    bool enabled = false;
-
-    bool autoQueue = false;   // (renamed from “Requeue”)
-    int  mapType = 0;         // 0=Freeplay, 1=Training, 2=Workshop
-
-    int  delayQueueSec    = 0;
-    int  delayFreeplaySec = 0;
-    int  delayTrainingSec = 0;
-    int  delayWorkshopSec = 0;
-
-    int  currentIndex = 0;           // freeplay
-    int  currentTrainingIndex = 0;   // training
-    int  currentWorkshopIndex = 0;   // workshop
+    ss_settings::Values settings; // every persisted setting, see SettingsSchema.h
+    // CVar handles for the fields that have one, kept from registration so
+    // syncing a value never looks a CVar up by name.
+    std::array<std::optional<CVarWrapper>, ss_settings::kFieldCount> settingCvars;
+
+    // RLTraining, trainingIndex, trainingJournal, trainingListVersion and
+    // the shuffle state are changed by console notifiers and hooks on the
+    // game thread and read by the settings page on the render thread;
+    // both hold this. Taken before workshopScanMutex when both are needed.
+    std::mutex trainingMutex;
+
+    // Bumped whenever RLTraining / RLWorkshop change, so the pickers'
+    // search indexes know to rebuild.
+    std::uint64_t trainingListVersion = 0;
+    std::uint64_t workshopListVersion = 0;
+
+    // Code -> position in RLTraining; rebuilt on load, extended on add.
+    ss_training::CodeIndex trainingIndex;
+    // Adds/removes since the list file was last written.
+    ss_training::Journal trainingJournal;
 
     // Auto-shuffle for training maps (minimal, in-memory)
     bool trainingShuffleEnabled = false;
@@ -85,7 +126,48 @@ private:
 
     std::string lastGameMode = "";
 
+    // SaveSettings only queues a snapshot; the file is written once the
+    // settings UI has been quiet for a moment, and on unload.
+    ss_io::WriteBehind settingsWriter{ std::chrono::milliseconds(500) };
+
+    // Last loaded snapshot; saves start from it so fields written by a
+    // newer build survive a round trip through this one.
+    ss_settings::Snapshot settingsSnapshot;
+
+    // Persistent scan cache backing LoadWorkshopMaps (owned by the scan thread while it runs)
+    ss_index::WorkshopIndex workshopIndex;
+
+    // Background workshop rescan. The scan thread only appends to
+    // workshopScanPending; RLWorkshop is updated by DrainWorkshopScan,
+    // which the scan and the watcher schedule on the game thread, so the
+    // list fills in whether or not the settings page is ever opened.
+    // Every read or write of RLWorkshop holds workshopScanMutex; scans are
+    // started and cancelled on the game thread only.
+    std::thread workshopScanThread;
+    std::atomic<bool> workshopScanCancel{ false };
+    std::atomic<bool> workshopScanRunning{ false };
+    std::atomic<bool> workshopScanDone{ false };
+    std::atomic<bool> workshopScanComplete{ false };
+    std::mutex workshopScanMutex;
+    std::vector<WorkshopEntry> workshopScanPending;
+    std::string workshopScanKeepPath;
+    std::atomic<bool> workshopDrainQueued{ false };
+
+    // Filesystem watcher on the workshop roots; deltas are queued under
+    // workshopScanMutex and applied by DrainWorkshopScan in one batch.
+    ss_watch::Watcher workshopWatcher;
+    std::vector<WorkshopEntry> workshopWatchAdded;
+    std::vector<std::string> workshopWatchRemoved;
+    bool workshopWatchRescan = false;
+
+    // Expires on unload, so work queued with gameWrapper->Execute that
+    // runs afterwards does nothing.
+    std::shared_ptr<bool> aliveToken = std::make_shared<bool>(true);
+
     // helpers
+    void RunOnGameThread(std::function<void()> fn);
+    void OnSettingChanged(std::size_t field);
+    void PushSettingCvar(std::size_t field);
     void BuildTrainingShuffleBag();
     int  NextTrainingIndex();
 };
\ No newline at end of file
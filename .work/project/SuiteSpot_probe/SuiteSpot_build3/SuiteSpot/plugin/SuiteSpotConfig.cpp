@@ -4,69 +4,129 @@
 // SuiteSpotConfig.h. Uses a simple key=value format with one entry per
 // line. Lines beginning with '#' are treated as comments and ignored. The
 // file is stored under `%AppData%/bakkesmod/bakkesmod/data/SuiteSpot`.
+//
+// All state lives in one Store guarded by a mutex. Each change hands a
+// snapshot of the table to a WriteBehind, which writes it out once writes
+// have been quiet for kFlushDelay.
 
+#include "pch.h"
 #include "SuiteSpotConfig.h"
+#include "WriteBehind.h"
 #include <fstream>
+#include <mutex>
 #include <system_error>
+#include <unordered_map>
+#include <utility>
 
 namespace ss_cfg {
 
-    // Ensures that the SuiteSpot data directory exists. The directory is
-    // created if it does not already exist. Any errors are silently
-    // ignored; callers should handle missing directories during file I/O.
-    static void ensureDir() {
-        std::error_code ec;
-        fs::create_directories(suiteSpotDataDir(), ec);
-    }
+    namespace {
+        using Entries = std::vector<std::pair<std::string, std::string>>;
+
+        struct Store {
+            std::mutex m;
+            bool loaded = false;
+            Entries entries;                                    // file order
+            std::unordered_map<std::string, std::size_t> index; // key -> entries slot
+        };
+
+        Store& store() {
+            static Store s;
+            return s;
+        }
 
-    // Reads all key=value entries from the configuration file into a vector
-    // of pairs. If the file cannot be opened, an empty vector is returned.
-    static std::vector<std::pair<std::string, std::string>> parseAll() {
-        std::vector<std::pair<std::string, std::string>> kv;
-        const auto cfg = suiteSpotCfgPath();
-        std::ifstream in(cfg.string());
-        if (!in.is_open()) return kv;
-        std::string line;
-        while (std::getline(in, line)) {
-            // Skip comments and empty lines
-            if (line.empty() || line[0] == '#') continue;
-            auto pos = line.find('=');
-            if (pos == std::string::npos) continue;
-            std::string key = line.substr(0, pos);
-            std::string val = line.substr(pos + 1);
-            kv.push_back({ key, val });
+        ss_io::WriteBehind& writer() {
+            static ss_io::WriteBehind w(kFlushDelay);
+            return w;
+        }
+
+        // Ensures that the SuiteSpot data directory exists. The directory is
+        // created if it does not already exist. Any errors are silently
+        // ignored; callers should handle missing directories during file I/O.
+        void ensureDir() {
+            std::error_code ec;
+            fs::create_directories(suiteSpotDataDir(), ec);
+        }
+
+        // Reads all key=value entries from the configuration file. If the
+        // file cannot be opened, nothing is loaded. Caller holds the lock.
+        void loadLocked(Store& s) {
+            if (s.loaded) return;
+            s.loaded = true;
+            std::ifstream in(suiteSpotCfgPath().string());
+            if (!in.is_open()) return;
+            std::string line;
+            while (std::getline(in, line)) {
+                // Skip comments and empty lines
+                if (line.empty() || line[0] == '#') continue;
+                auto pos = line.find('=');
+                if (pos == std::string::npos) continue;
+                std::string key = line.substr(0, pos);
+                auto it = s.index.find(key);
+                if (it != s.index.end()) {
+                    s.entries[it->second].second = line.substr(pos + 1);
+                } else {
+                    s.index.emplace(key, s.entries.size());
+                    s.entries.push_back({ std::move(key), line.substr(pos + 1) });
+                }
+            }
+        }
+
+        // Writes a snapshot via temp file + rename. Returns false on failure
+        // so the write-behind retries it later.
+        bool writeFile(const Entries& entries) {
+            ensureDir();
+            const auto cfg = suiteSpotCfgPath();
+            fs::path tmp = cfg;
+            tmp += ".tmp";
+            {
+                std::ofstream out(tmp.string(), std::ios::trunc);
+                if (!out.is_open()) return false;
+                for (const auto& [k, v] : entries) {
+                    out << k << '=' << v << '\n';
+                }
+                out.flush();
+                if (!out) return false;
+            }
+            std::error_code ec;
+            fs::rename(tmp, cfg, ec);
+            if (ec) { fs::remove(tmp, ec); return false; }
+            return true;
         }
-        return kv;
     }
 
     std::string read(const std::string& key) {
-        auto entries = parseAll();
-        for (const auto& [k, v] : entries) {
-            if (k == key) return v;
-        }
-        return "";
+        Store& s = store();
+        std::lock_guard<std::mutex> lk(s.m);
+        loadLocked(s);
+        auto it = s.index.find(key);
+        return it != s.index.end() ? s.entries[it->second].second : "";
     }
 
     void write(const std::string& key, const std::string& val) {
-        ensureDir();
-        auto entries = parseAll();
-        bool found = false;
-        for (auto& [k, v] : entries) {
-            if (k == key) {
-                v = val;
-                found = true;
-                break;
+        Store& s = store();
+        Entries snapshot;
+        {
+            std::lock_guard<std::mutex> lk(s.m);
+            loadLocked(s);
+            auto it = s.index.find(key);
+            if (it != s.index.end()) {
+                if (s.entries[it->second].second == val) return;
+                s.entries[it->second].second = val;
+            } else {
+                s.index.emplace(key, s.entries.size());
+                s.entries.push_back({ key, val });
             }
+            snapshot = s.entries;
         }
-        if (!found) {
-            entries.push_back({ key, val });
-        }
-        // Write back all entries
-        std::ofstream out(suiteSpotCfgPath().string(), std::ios::trunc);
-        if (!out.is_open()) return;
-        for (const auto& [k, v] : entries) {
-            out << k << '=' << v << '\n';
-        }
+        writer().request([snapshot = std::move(snapshot)] { return writeFile(snapshot); });
     }
 
+    void flush() { writer().flush(); }
+
+    void shutdown() { writer().stop(); }
+
+    std::uint64_t writesRequested() { return writer().requested(); }
+    std::uint64_t writesPerformed() { return writer().performed(); }
+
 } // namespace ss_cfg
@@ -5,9 +5,16 @@
 // `SuiteSpot` subfolder. This avoids any dependency on other plugins (such as
 // WorkshopMapLoader) for configuration storage and allows SuiteSpot to
 // remember user preferences between sessions.
+//
+// The file is parsed once, on first use, into an in-memory table. Writes
+// only update the table; a background flush (ss_io::WriteBehind) rewrites
+// the file after writes have been quiet for kFlushDelay, so typing into a
+// path field costs one disk write rather than one per keystroke.
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <filesystem>
 #include <string>
 #include <vector>
@@ -35,15 +42,31 @@ namespace ss_cfg {
     // exist; callers should handle that case appropriately.
     inline fs::path suiteSpotCfgPath() { return suiteSpotDataDir() / "suitespot.cfg"; }
 
-    // Reads the value for a given key from the configuration file. If the
-    // key is not present, an empty string is returned. The key search is
-    // case-sensitive. This function creates no files or directories.
+    // Quiet period after the last write before the file is rewritten.
+    constexpr std::chrono::milliseconds kFlushDelay{ 750 };
+
+    // Reads the value for a given key. If the key is not present, an empty
+    // string is returned. The key search is case-sensitive. The first call
+    // loads the file; later calls are served from memory. This function
+    // creates no files or directories.
     std::string read(const std::string& key);
 
-    // Writes (or updates) a key=value pair in the configuration file.
-    // If the file or its parent directory does not exist, they will be
-    // created. If the key already exists in the file, its value will be
-    // overwritten. Otherwise, the key/value pair is appended at the end of
-    // the file. Keys are case-sensitive.
+    // Writes (or updates) a key=value pair. If the key already exists its
+    // value is overwritten, otherwise the pair is appended at the end. Keys
+    // are case-sensitive. The file (and its parent directory) is written by
+    // the background flush, not by this call.
     void write(const std::string& key, const std::string& val);
+
+    // Writes pending changes now. The file is written to a temporary
+    // sibling and renamed into place, so a crash mid-write leaves the
+    // previous file intact.
+    void flush();
+
+    // Stops the background flush thread, then flushes. Call from onUnload;
+    // a later write() starts the thread again.
+    void shutdown();
+
+    // write() calls that changed a value, and file writes actually done.
+    std::uint64_t writesRequested();
+    std::uint64_t writesPerformed();
 }
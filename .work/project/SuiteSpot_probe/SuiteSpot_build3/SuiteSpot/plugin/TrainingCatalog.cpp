@@ -0,0 +1,146 @@
+// TrainingCatalog.cpp
+//
+// Open-addressed table with linear probing, kept at most half full. Slots
+// hold a key number and a hash tag; the keys themselves sit in one string
+// buffer, so indexing 100k packs costs a few large allocations rather than
+// one per code.
+
+#include "pch.h"
+#include "TrainingCatalog.h"
+#include <cstring>
+
+namespace ss_training {
+
+    namespace {
+        // Pack codes are short, so a few multiply-xorshift rounds over 8-byte
+        // words beat a general-purpose streaming hash here.
+        inline std::uint64_t hashKey(std::string_view s) {
+            const char* p = s.data();
+            std::size_t n = s.size();
+            std::uint64_t h = 0x9E3779B97F4A7C15ULL ^ n;
+            std::uint64_t w;
+            for (; n >= 8; p += 8, n -= 8) {
+                std::memcpy(&w, p, 8);
+                h = (h ^ w) * 0xBF58476D1CE4E5B9ULL;
+                h ^= h >> 31;
+            }
+            w = 0;
+            std::memcpy(&w, p, n);
+            h = (h ^ w) * 0x94D049BB133111EBULL;
+            return h ^ (h >> 29);
+        }
+
+        inline std::uint32_t tagOf(std::uint64_t h) { return static_cast<std::uint32_t>(h >> 32); }
+
+        // Normalizes into a stack buffer for typical codes; longer ones
+        // spill into `spill`.
+        struct NormalizedKey {
+            char buf[48];
+            std::string spill;
+            std::string_view view;
+
+            explicit NormalizedKey(std::string_view code) {
+                std::size_t n = 0;
+                for (char c : code) {
+                    if (n == sizeof(buf)) break;
+                    if (c >= 'a' && c <= 'z') buf[n++] = static_cast<char>(c - 'a' + 'A');
+                    else if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) buf[n++] = c;
+                }
+                if (n < sizeof(buf)) { view = std::string_view(buf, n); return; }
+                normalizeCode(code, spill);
+                view = spill;
+            }
+        };
+    }
+
+    void normalizeCode(std::string_view code, std::string& out) {
+        out.clear();
+        out.reserve(code.size());
+        for (char c : code) {
+            if (c >= 'a' && c <= 'z') out.push_back(static_cast<char>(c - 'a' + 'A'));
+            else if ((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9')) out.push_back(c);
+        }
+    }
+
+    std::string_view CodeIndex::keyAt(std::size_t k) const {
+        return std::string_view(keys_.data() + keyOffsets_[k], keyOffsets_[k + 1] - keyOffsets_[k]);
+    }
+
+    std::size_t CodeIndex::probe(std::string_view key, std::uint64_t h) const {
+        const std::size_t mask = slots_.size() - 1;
+        const std::uint32_t tag = tagOf(h);
+        std::size_t i = static_cast<std::size_t>(h) & mask;
+        for (; slots_[i].index; i = (i + 1) & mask) {
+            if (slots_[i].tag == tag && keyAt(slots_[i].index - 1) == key) break;
+        }
+        return i;
+    }
+
+    void CodeIndex::rehash(std::size_t minSlots) {
+        std::size_t cap = slots_.empty() ? 64 : slots_.size() * 2;
+        while (cap < minSlots) cap <<= 1;
+        std::vector<Slot> old(cap);
+        old.swap(slots_);
+        const std::size_t mask = cap - 1;
+        for (std::size_t k = 0; k < count_; ++k) {
+            const std::uint64_t h = hashKey(keyAt(k));
+            std::size_t i = static_cast<std::size_t>(h) & mask;
+            while (slots_[i].index) i = (i + 1) & mask;
+            slots_[i] = { static_cast<std::uint32_t>(k + 1), tagOf(h) };
+        }
+    }
+
+    void CodeIndex::clear() {
+        slots_.clear();
+        keys_.clear();
+        keyOffsets_.clear();
+        keyEntry_.clear();
+        count_ = 0;
+    }
+
+    void CodeIndex::reserve(std::size_t n) {
+        if (n * 2 > slots_.size()) rehash(n * 2);
+        keyOffsets_.reserve(n + 1);
+        keyEntry_.reserve(n);
+        keys_.reserve(n * 16);
+    }
+
+    void CodeIndex::rebuild(const std::vector<TrainingEntry>& entries) {
+        clear();
+        reserve(entries.size());
+        for (std::size_t i = 0; i < entries.size(); ++i) insert(entries[i].code, i);
+    }
+
+    int CodeIndex::find(std::string_view code) const {
+        if (count_ == 0) return -1;
+        const NormalizedKey key(code);
+        if (key.view.empty()) return -1;
+        const Slot& s = slots_[probe(key.view, hashKey(key.view))];
+        return s.index ? static_cast<int>(keyEntry_[s.index - 1]) : -1;
+    }
+
+    bool CodeIndex::insert(std::string_view code, std::size_t index) {
+        const NormalizedKey key(code);
+        if (key.view.empty()) return false;
+        if ((count_ + 1) * 2 > slots_.size()) rehash((count_ + 1) * 2);
+        const std::uint64_t h = hashKey(key.view);
+        const std::size_t i = probe(key.view, h);
+        if (slots_[i].index) return false;
+
+        if (keyOffsets_.empty()) keyOffsets_.push_back(0);
+        keys_.append(key.view.data(), key.view.size());
+        keyOffsets_.push_back(static_cast<std::uint32_t>(keys_.size()));
+        keyEntry_.push_back(static_cast<std::uint32_t>(index));
+        slots_[i] = { static_cast<std::uint32_t>(++count_), tagOf(h) };
+        return true;
+    }
+
+    std::pair<int, bool> CodeIndex::add(std::vector<TrainingEntry>& entries, TrainingEntry e) {
+        const int existing = find(e.code);
+        if (existing >= 0) return { existing, false };
+        if (!insert(e.code, entries.size())) return { -1, false };
+        entries.push_back(std::move(e));
+        return { static_cast<int>(entries.size() - 1), true };
+    }
+
+} // namespace ss_training
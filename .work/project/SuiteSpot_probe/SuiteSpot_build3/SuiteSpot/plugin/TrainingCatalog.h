@@ -0,0 +1,74 @@
+// TrainingCatalog.h
+//
+// Hash index over RLTraining keyed by the normalized pack code, so adding
+// a pack can reject a duplicate and lookups by code do not scan the list.
+// RLTraining itself stays a plain vector in file order; the index only
+// maps codes to positions in it. add() appends, so positions held
+// elsewhere stay valid. Removal (ss_training::removeAt, used by
+// SuiteSpot::RemoveTrainingMap) shifts every later entry down by one and
+// rebuilds this index; its callers must then fix up the positions they
+// hold: step CurrentTrainingIndex back if it pointed past the removed
+// entry (or clamp it to the new end), and rebuild the shuffle bag.
+//
+// Codes are compared in normalized form: ASCII letters and digits only,
+// upper-cased. "a503264ca7ebd282" and "A503-264C-A7EB-D282" are the same
+// pack.
+
+#pragma once
+
+#include "MapList.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ss_training {
+
+    // Appends the normalized form of `code` to `out` (after clearing it).
+    void normalizeCode(std::string_view code, std::string& out);
+
+    class CodeIndex {
+    public:
+        // Indexes `entries` from scratch. For repeated codes the first
+        // entry wins.
+        void rebuild(const std::vector<TrainingEntry>& entries);
+        void clear();
+        // Sizes the table and key buffers for `n` codes up front.
+        void reserve(std::size_t n);
+
+        // Position of the pack with this code, or -1.
+        int find(std::string_view code) const;
+
+        // Appends `e` to `entries` unless its code is already indexed (or
+        // normalizes to nothing). Returns the index of the new or existing
+        // entry (-1 for an unusable code) and whether it was added.
+        std::pair<int, bool> add(std::vector<TrainingEntry>& entries, TrainingEntry e);
+
+        // Records that entries[index] has `code`; returns false (and does
+        // nothing) if the code is already indexed. For callers that build
+        // the vector themselves, like the file parser.
+        bool insert(std::string_view code, std::size_t index);
+
+        std::size_t size() const { return count_; }
+
+    private:
+        struct Slot {
+            std::uint32_t index = 0; // entry index + 1; 0 = empty
+            std::uint32_t tag = 0;   // high hash bits, checked before comparing keys
+        };
+
+        // Normalized keys live back to back in one buffer, in entry order
+        // of insertion; keyOffsets_[k] is where key k starts.
+        std::string_view keyAt(std::size_t k) const;
+        std::size_t probe(std::string_view key, std::uint64_t h) const; // slot holding key, or the empty slot for it
+        void rehash(std::size_t minSlots); // at least doubles the table
+
+        std::vector<Slot> slots_;
+        std::string keys_;
+        std::vector<std::uint32_t> keyOffsets_;  // keys_ start per key, plus end sentinel
+        std::vector<std::uint32_t> keyEntry_;    // entry index per key
+        std::size_t count_ = 0;
+    };
+}
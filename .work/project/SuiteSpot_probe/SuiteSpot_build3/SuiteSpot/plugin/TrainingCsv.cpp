@@ -0,0 +1,199 @@
+// TrainingCsv.cpp
+//
+// Two passes over the mapped text: one memchr pass counts lines so the
+// entry vector and the code index are sized once, then each line is split
+// into field views, checked against the index and, if new, copied
+// straight into its entry. Nothing is allocated per line except the
+// entry's own strings.
+
+#include "pch.h"
+#include "TrainingCsv.h"
+#include "MappedFile.h"
+#include <cstring>
+
+namespace ss_training {
+
+    namespace {
+        struct Field {
+            std::string_view text; // without the surrounding quotes
+            bool escaped = false;  // contains "" pairs to collapse
+        };
+
+        struct Row {
+            Field code;
+            Field name;
+        };
+
+        inline bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\r'; }
+
+        std::string_view trim(std::string_view s) {
+            while (!s.empty() && isSpace(s.front())) s.remove_prefix(1);
+            while (!s.empty() && isSpace(s.back())) s.remove_suffix(1);
+            return s;
+        }
+
+        // `s` starts just after an opening quote. On success sets `out` and
+        // returns the offset just past the closing quote, or npos if the
+        // quote is never closed.
+        std::size_t readQuoted(std::string_view s, Field& out) {
+            std::size_t pos = 0;
+            bool escaped = false;
+            for (;;) {
+                const void* q = std::memchr(s.data() + pos, '"', s.size() - pos);
+                if (!q) return std::string_view::npos;
+                const std::size_t at = static_cast<const char*>(q) - s.data();
+                if (at + 1 < s.size() && s[at + 1] == '"') {
+                    escaped = true;
+                    pos = at + 2;
+                    continue;
+                }
+                out.text = s.substr(0, at);
+                out.escaped = escaped;
+                return at + 1;
+            }
+        }
+
+        // Splits one line into code and name. Returns nullptr on success or
+        // the reason the line is unusable.
+        const char* splitLine(std::string_view line, Row& row) {
+            std::string_view rest = line;
+            while (!rest.empty() && isSpace(rest.front())) rest.remove_prefix(1);
+
+            if (!rest.empty() && rest.front() == '"') {
+                const std::size_t end = readQuoted(rest.substr(1), row.code);
+                if (end == std::string_view::npos) return "unterminated quote";
+                rest = rest.substr(1 + end);
+                while (!rest.empty() && isSpace(rest.front())) rest.remove_prefix(1);
+                if (rest.empty()) return "missing comma";
+                if (rest.front() != ',') return "text after closing quote";
+                rest.remove_prefix(1);
+            } else {
+                const std::size_t comma = rest.find(',');
+                if (comma == std::string_view::npos) return "missing comma";
+                row.code.text = trim(rest.substr(0, comma));
+                rest = rest.substr(comma + 1);
+            }
+            if (row.code.text.empty()) return "empty code";
+
+            std::string_view name = trim(rest);
+            if (!name.empty() && name.front() == '"') {
+                const std::size_t end = readQuoted(name.substr(1), row.name);
+                if (end == std::string_view::npos) return "unterminated quote";
+                if (1 + end != name.size()) return "text after closing quote";
+            } else {
+                // Unquoted names keep interior commas, as before quoting existed.
+                while (!rest.empty() && rest.back() == '\r') rest.remove_suffix(1);
+                row.name.text = rest;
+            }
+            if (row.name.text.empty()) return "empty name";
+            return nullptr;
+        }
+
+        void assign(std::string& out, const Field& f) {
+            if (!f.escaped) { out.assign(f.text.data(), f.text.size()); return; }
+            out.clear();
+            out.reserve(f.text.size());
+            for (std::size_t i = 0; i < f.text.size(); ++i) {
+                out.push_back(f.text[i]);
+                if (f.text[i] == '"' && i + 1 < f.text.size() && f.text[i + 1] == '"') ++i;
+            }
+        }
+
+        bool needsQuotes(const std::string& s) {
+            if (s.empty()) return false;
+            if (isSpace(s.front()) || isSpace(s.back())) return true;
+            for (char c : s) {
+                if (c == ',' || c == '"' || c == '\n' || c == '\r') return true;
+            }
+            return false;
+        }
+
+        void appendField(std::string& out, const std::string& s) {
+            if (!needsQuotes(s)) { out += s; return; }
+            out += '"';
+            for (char c : s) {
+                if (c == '\r' || c == '\n') c = ' ';
+                if (c == '"') out += '"';
+                out += c;
+            }
+            out += '"';
+        }
+    }
+
+    ParseResult parse(std::string_view text) {
+        ParseResult r;
+        if (text.size() >= 3 && std::memcmp(text.data(), "\xEF\xBB\xBF", 3) == 0) text.remove_prefix(3);
+
+        const char* const begin = text.data();
+        const char* const end = begin + text.size();
+
+        std::size_t lineCount = 1;
+        for (const char* p = begin; p < end; ++lineCount) {
+            const void* nl = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+            if (!nl) break;
+            p = static_cast<const char*>(nl) + 1;
+        }
+        r.entries.reserve(lineCount);
+        r.index.reserve(lineCount);
+
+        std::string unescaped;
+        std::size_t lineNo = 0;
+        for (const char* p = begin; p < end;) {
+            const void* nl = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+            const char* eol = nl ? static_cast<const char*>(nl) : end;
+            const std::string_view line(p, static_cast<std::size_t>(eol - p));
+            p = nl ? eol + 1 : end;
+            ++lineNo;
+
+            if (trim(line).empty()) continue;
+            ++r.lines;
+            Row row{ {}, {} };
+            if (const char* why = splitLine(line, row)) {
+                r.issues.push_back({ lineNo, why });
+                continue;
+            }
+
+            std::string_view key = row.code.text;
+            if (row.code.escaped) {
+                assign(unescaped, row.code);
+                key = unescaped;
+            }
+            if (!r.index.insert(key, r.entries.size())) {
+                if (r.index.find(key) >= 0) {
+                    ++r.duplicates;
+                    r.issues.push_back({ lineNo, "duplicate code" });
+                } else {
+                    r.issues.push_back({ lineNo, "code has no letters or digits" });
+                }
+                continue;
+            }
+
+            TrainingEntry& e = r.entries.emplace_back();
+            e.code.assign(key.data(), key.size());
+            assign(e.name, row.name);
+        }
+        return r;
+    }
+
+    bool load(const fs::path& file, ParseResult& out) {
+        ss_io::MappedFile map;
+        if (!map.open(file)) return false;
+        out = parse(map.view());
+        return true;
+    }
+
+    std::string serialize(const std::vector<TrainingEntry>& entries) {
+        std::size_t bytes = 0;
+        for (const auto& e : entries) bytes += e.code.size() + e.name.size() + 2;
+        std::string out;
+        out.reserve(bytes + bytes / 16);
+        for (const auto& e : entries) {
+            appendField(out, e.code);
+            out += ',';
+            appendField(out, e.name);
+            out += '\n';
+        }
+        return out;
+    }
+
+} // namespace ss_training
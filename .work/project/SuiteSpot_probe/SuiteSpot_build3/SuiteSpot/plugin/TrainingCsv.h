@@ -0,0 +1,47 @@
+// TrainingCsv.h
+//
+// Reader and writer for SuiteTraining\SuiteSpotTrainingMaps.txt, one
+// `<code>,<name>` pair per line. Either field may be wrapped in double
+// quotes, with "" for a literal quote, so names can contain commas; an
+// unquoted name still runs to the end of the line as it always has.
+//
+// The file is memory-mapped and split into lines with memchr; fields stay
+// string_views into the mapping until a line is accepted, and entries are
+// built in one pre-sized vector. Repeated codes keep their first entry;
+// codes are compared the way CodeIndex normalizes them.
+// Lines that cannot be used are reported with their line number.
+
+#pragma once
+
+#include "MapList.h"
+#include "TrainingCatalog.h"
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ss_training {
+    namespace fs = std::filesystem;
+
+    struct Issue {
+        std::size_t line;   // 1-based
+        const char* reason; // static string
+    };
+
+    struct ParseResult {
+        std::vector<TrainingEntry> entries;
+        CodeIndex index;             // over `entries`, ready to hand to the catalog
+        std::vector<Issue> issues;   // malformed lines and duplicate codes, in file order
+        std::size_t lines = 0;       // non-blank lines
+        std::size_t duplicates = 0;
+    };
+
+    ParseResult parse(std::string_view text);
+
+    // Maps and parses `file`. Returns false if it could not be opened.
+    bool load(const fs::path& file, ParseResult& out);
+
+    // The whole file for `entries`, quoting fields only where needed.
+    std::string serialize(const std::vector<TrainingEntry>& entries);
+}
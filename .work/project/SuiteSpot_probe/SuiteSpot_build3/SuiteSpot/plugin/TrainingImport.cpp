@@ -0,0 +1,122 @@
+// TrainingImport.cpp
+//
+// isPackCode checks all 19 bytes with two overlapping 16-byte SSE2 loads
+// (bytes 0-15 and 3-18): one classification pass per load yields a hex
+// mask and a dash mask, and each is compared with the fixed layout. x64
+// always has SSE2; other targets use the scalar loop.
+
+#include "pch.h"
+#include "TrainingImport.h"
+#include "TrainingCsv.h"
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+#define SS_PACKCODE_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace ss_training {
+
+    namespace {
+        constexpr std::size_t kMaxSamples = 5;
+
+#if SS_PACKCODE_SSE2
+        // Dash positions 4, 9 and 14 as seen from each load.
+        constexpr int kDashesLo = (1 << 4) | (1 << 9) | (1 << 14);
+        constexpr int kDashesHi = (1 << 1) | (1 << 6) | (1 << 11);
+
+        // Returns (dash mask << 16) | hex mask for 16 bytes.
+        inline unsigned classify(__m128i v) {
+            const __m128i lower = _mm_or_si128(v, _mm_set1_epi8(0x20));
+            // Bytes >= 0x80 are negative as signed chars and fail both ranges.
+            const __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('0' - 1)),
+                                                _mm_cmplt_epi8(v, _mm_set1_epi8('9' + 1)));
+            const __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                                _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+            const __m128i dash = _mm_cmpeq_epi8(v, _mm_set1_epi8('-'));
+            const unsigned hex = static_cast<unsigned>(_mm_movemask_epi8(_mm_or_si128(digit, alpha)));
+            return (static_cast<unsigned>(_mm_movemask_epi8(dash)) << 16) | hex;
+        }
+
+        inline bool isPackCodeSse2(const char* p) {
+            const unsigned lo = classify(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p)));
+            const unsigned hi = classify(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + 3)));
+            constexpr unsigned wantLo = (unsigned(kDashesLo) << 16) | (~unsigned(kDashesLo) & 0xFFFFu);
+            constexpr unsigned wantHi = (unsigned(kDashesHi) << 16) | (~unsigned(kDashesHi) & 0xFFFFu);
+            return lo == wantLo && hi == wantHi;
+        }
+#else
+        inline bool isHex(char c) {
+            return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+        }
+
+        bool isPackCodeScalar(const char* p) {
+            for (std::size_t i = 0; i < kPackCodeLength; ++i) {
+                const bool dash = (i % 5) == 4;
+                if (dash ? p[i] != '-' : !isHex(p[i])) return false;
+            }
+            return true;
+        }
+#endif
+
+        void upperHex(std::string& code) {
+            for (char& c : code) {
+                if (c >= 'a' && c <= 'f') c = static_cast<char>(c - 'a' + 'A');
+            }
+        }
+    }
+
+    bool isPackCode(std::string_view code) {
+        if (code.size() != kPackCodeLength) return false;
+#if SS_PACKCODE_SSE2
+        return isPackCodeSse2(code.data());
+#else
+        return isPackCodeScalar(code.data());
+#endif
+    }
+
+    ImportResult importPacks(std::string_view text, std::vector<TrainingEntry>& entries, CodeIndex& index) {
+        ImportResult r;
+        ParseResult parsed = parse(text);
+        r.lines = parsed.lines;
+        r.known = parsed.duplicates;
+        r.malformed = parsed.issues.size() - parsed.duplicates;
+
+        entries.reserve(entries.size() + parsed.entries.size());
+        for (auto& e : parsed.entries) {
+            if (!isPackCode(e.code)) {
+                ++r.badCodes;
+                if (r.samples.size() < kMaxSamples) r.samples.push_back(e.code);
+                continue;
+            }
+            upperHex(e.code);
+            if (index.add(entries, std::move(e)).second) ++r.added;
+            else ++r.known;
+        }
+        return r;
+    }
+
+    std::string readClipboardText() {
+        std::string out;
+#if defined(_WIN32)
+        if (!OpenClipboard(nullptr)) return out;
+        if (HANDLE h = GetClipboardData(CF_UNICODETEXT)) {
+            if (const auto* w = static_cast<const wchar_t*>(GlobalLock(h))) {
+                const int n = WideCharToMultiByte(CP_UTF8, 0, w, -1, nullptr, 0, nullptr, nullptr);
+                if (n > 1) {
+                    out.resize(static_cast<std::size_t>(n));
+                    WideCharToMultiByte(CP_UTF8, 0, w, -1, out.data(), n, nullptr, nullptr);
+                    out.resize(static_cast<std::size_t>(n - 1));
+                }
+                GlobalUnlock(h);
+            }
+        }
+        CloseClipboard();
+#endif
+        return out;
+    }
+
+} // namespace ss_training
@@ -0,0 +1,42 @@
+// TrainingImport.h
+//
+// Bulk import of `code,name` lines into the training catalog, for pack
+// lists pasted from a coach's spreadsheet or saved as a file. Lines are
+// split by the same reader as SuiteSpotTrainingMaps.txt; codes must be
+// canonical XXXX-XXXX-XXXX-XXXX hex pack codes and are stored
+// upper-cased. Nothing is written here: the caller saves once after the
+// whole batch.
+
+#pragma once
+
+#include "MapList.h"
+#include "TrainingCatalog.h"
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ss_training {
+
+    constexpr std::size_t kPackCodeLength = 19; // XXXX-XXXX-XXXX-XXXX
+
+    // True if `code` is exactly four dash-separated groups of four hex
+    // digits (either case).
+    bool isPackCode(std::string_view code);
+
+    struct ImportResult {
+        std::size_t lines = 0;        // non-blank lines seen
+        std::size_t added = 0;
+        std::size_t known = 0;        // already in the catalog (or repeated in the batch)
+        std::size_t malformed = 0;    // unusable lines
+        std::size_t badCodes = 0;     // well-formed lines whose code is not a pack code
+        std::vector<std::string> samples; // first few rejected codes, for the log
+    };
+
+    // Appends every new, valid pack in `text` to `entries` through `index`.
+    ImportResult importPacks(std::string_view text, std::vector<TrainingEntry>& entries, CodeIndex& index);
+
+    // Text on the system clipboard as UTF-8; empty if there is none or the
+    // platform has no clipboard we can reach from here.
+    std::string readClipboardText();
+}
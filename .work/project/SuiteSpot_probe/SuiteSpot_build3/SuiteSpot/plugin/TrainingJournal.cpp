@@ -0,0 +1,154 @@
+// TrainingJournal.cpp
+//
+// The journal is read through a mapping and written with stdio in append
+// mode; each record is assembled in one buffer and handed over with a
+// single fwrite + fflush, so a crash loses at most the record in flight.
+
+#include "pch.h"
+#include "TrainingJournal.h"
+#include "ContentHash.h"
+#include "MappedFile.h"
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+namespace ss_training {
+
+    namespace {
+        constexpr char kMagic[4] = { 'S', 'S', 'T', 'J' };
+        constexpr std::uint16_t kVersion = 1;
+        constexpr std::size_t kHeaderBytes = 8;
+        constexpr std::size_t kRecordHeaderBytes = 8;
+        constexpr std::size_t kMaxPayload = 1 << 16;
+
+        template <typename T>
+        T readLE(const char* p) { T v; std::memcpy(&v, p, sizeof(T)); return v; }
+
+        template <typename T>
+        void writeLE(std::string& out, T v) { out.append(reinterpret_cast<const char*>(&v), sizeof(T)); }
+
+        std::uint32_t checksum(const char* p, std::size_t n) {
+            return static_cast<std::uint32_t>(ss_hash::hash64(p, n));
+        }
+
+        std::FILE* openFile(const fs::path& file, bool truncate) {
+#if defined(_WIN32)
+            return _wfopen(file.c_str(), truncate ? L"wb" : L"ab");
+#else
+            return std::fopen(file.c_str(), truncate ? "wb" : "ab");
+#endif
+        }
+
+        bool writeHeader(std::FILE* f) {
+            std::string h(kMagic, sizeof(kMagic));
+            writeLE<std::uint16_t>(h, kVersion);
+            writeLE<std::uint16_t>(h, 0);
+            return std::fwrite(h.data(), 1, h.size(), f) == h.size() && std::fflush(f) == 0;
+        }
+    }
+
+    void removeAt(std::vector<TrainingEntry>& entries, CodeIndex& index, std::size_t pos) {
+        entries.erase(entries.begin() + static_cast<std::ptrdiff_t>(pos));
+        index.rebuild(entries);
+    }
+
+    ReplayResult replay(const fs::path& file, std::vector<TrainingEntry>& entries, CodeIndex& index) {
+        ReplayResult r;
+        ss_io::MappedFile map;
+        if (!map.open(file) || map.size() == 0) return r;
+        const char* p = map.data();
+        const char* const end = p + map.size();
+        if (map.size() < kHeaderBytes || std::memcmp(p, kMagic, sizeof(kMagic)) != 0 ||
+            readLE<std::uint16_t>(p + 4) != kVersion) {
+            r.torn = true;
+            return r;
+        }
+        p += kHeaderBytes;
+
+        while (p < end) {
+            if (static_cast<std::size_t>(end - p) < kRecordHeaderBytes) { r.torn = true; break; }
+            const std::uint32_t len = readLE<std::uint32_t>(p);
+            const std::uint32_t sum = readLE<std::uint32_t>(p + 4);
+            const char* payload = p + kRecordHeaderBytes;
+            if (len < 3 || len > kMaxPayload || static_cast<std::size_t>(end - payload) < len ||
+                checksum(payload, len) != sum) { r.torn = true; break; }
+            const std::uint16_t codeLen = readLE<std::uint16_t>(payload + 1);
+            if (3u + codeLen > len) { r.torn = true; break; }
+            p = payload + len;
+            ++r.records;
+
+            const std::string_view code(payload + 3, codeLen);
+            const int at = index.find(code);
+            if (static_cast<JournalOp>(payload[0]) == JournalOp::Add) {
+                if (at >= 0) continue;
+                TrainingEntry e{ std::string(code), std::string(payload + 3 + codeLen, len - 3 - codeLen) };
+                if (index.add(entries, std::move(e)).second) ++r.added;
+            } else if (static_cast<JournalOp>(payload[0]) == JournalOp::Remove) {
+                if (at < 0) continue;
+                removeAt(entries, index, static_cast<std::size_t>(at));
+                ++r.removed;
+            }
+        }
+        return r;
+    }
+
+    void Journal::open(const fs::path& file) {
+        close();
+        path_ = file;
+        records_ = 0;
+    }
+
+    void Journal::close() {
+        if (file_) std::fclose(file_);
+        file_ = nullptr;
+    }
+
+    bool Journal::ensureOpen() {
+        if (file_) return true;
+        if (path_.empty()) return false;
+        std::error_code ec;
+        const bool fresh = fs::file_size(path_, ec) == 0 || ec;
+        file_ = openFile(path_, fresh);
+        if (!file_) return false;
+        if (fresh && !writeHeader(file_)) { close(); return false; }
+        return true;
+    }
+
+    bool Journal::append(JournalOp op, const TrainingEntry& e) {
+        if (e.code.size() > 0xFFFF || 3 + e.code.size() + e.name.size() > kMaxPayload) return false;
+        if (!ensureOpen()) return false;
+
+        std::string rec;
+        rec.reserve(kRecordHeaderBytes + 3 + e.code.size() + e.name.size());
+        rec.resize(kRecordHeaderBytes);
+        rec += static_cast<char>(op);
+        writeLE<std::uint16_t>(rec, static_cast<std::uint16_t>(e.code.size()));
+        rec += e.code;
+        if (op == JournalOp::Add) rec += e.name;
+
+        const std::uint32_t len = static_cast<std::uint32_t>(rec.size() - kRecordHeaderBytes);
+        const std::uint32_t sum = checksum(rec.data() + kRecordHeaderBytes, len);
+        std::memcpy(&rec[0], &len, sizeof(len));
+        std::memcpy(&rec[4], &sum, sizeof(sum));
+
+        if (std::fwrite(rec.data(), 1, rec.size(), file_) != rec.size() || std::fflush(file_) != 0) {
+            close();
+            return false;
+        }
+        ++records_;
+        return true;
+    }
+
+    bool Journal::reset() {
+        close();
+        records_ = 0;
+        if (path_.empty()) return false;
+        std::error_code ec;
+        if (!fs::exists(path_, ec)) return true;
+        file_ = openFile(path_, true);
+        if (!file_) return false;
+        if (!writeHeader(file_)) { close(); return false; }
+        return true;
+    }
+
+} // namespace ss_training
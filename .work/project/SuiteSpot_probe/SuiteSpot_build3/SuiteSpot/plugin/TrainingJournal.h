@@ -0,0 +1,74 @@
+// TrainingJournal.h
+//
+// Append-only log of training-pack adds and removes, kept next to
+// SuiteSpotTrainingMaps.txt so a single add costs one small write instead
+// of rewriting the whole list. The list file stays the base; on load the
+// journal is replayed on top of it and then folded back in (compacted).
+//
+// Layout: "SSTJ", u16 version, u16 reserved, then records of
+//   u32 payload bytes, u32 checksum (low half of xxHash64 of the payload),
+//   payload = u8 op ('+' or '-'), u16 code bytes, code, name.
+// Replay stops at the first short or mismatching record, which is what a
+// crash in the middle of an append leaves behind.
+//
+// Replaying onto a base that already contains the journal's effects (a
+// crash between writing the base and truncating the journal) yields the
+// same list: each code ends up in the state of its last record, and a
+// re-add of a present code does not move it.
+
+#pragma once
+
+#include "MapList.h"
+#include "TrainingCatalog.h"
+#include <cstddef>
+#include <cstdio>
+#include <filesystem>
+
+namespace ss_training {
+    namespace fs = std::filesystem;
+
+    enum class JournalOp : unsigned char { Add = '+', Remove = '-' };
+
+    struct ReplayResult {
+        std::size_t records = 0; // intact records read
+        std::size_t added = 0;
+        std::size_t removed = 0;
+        bool torn = false;       // trailing bytes that were not a whole, valid record
+    };
+
+    // Applies the journal at `file` to `entries`, keeping `index` in step.
+    // A missing or empty journal applies nothing.
+    ReplayResult replay(const fs::path& file, std::vector<TrainingEntry>& entries, CodeIndex& index);
+
+    // Removes entries[pos] and reindexes. Later entries shift down by one.
+    void removeAt(std::vector<TrainingEntry>& entries, CodeIndex& index, std::size_t pos);
+
+    class Journal {
+    public:
+        Journal() = default;
+        ~Journal() { close(); }
+        Journal(const Journal&) = delete;
+        Journal& operator=(const Journal&) = delete;
+
+        // Sets the file; it is opened on the first append.
+        void open(const fs::path& file);
+        void close();
+
+        // Writes one record and flushes it to the OS.
+        bool append(JournalOp op, const TrainingEntry& e);
+
+        // Empties the journal after its records have been compacted into
+        // the base file.
+        bool reset();
+
+        // Records appended since the last reset.
+        std::size_t records() const { return records_; }
+
+    private:
+        bool ensureOpen();
+
+        fs::path path_;
+        std::FILE* file_ = nullptr;
+        std::size_t records_ = 0;
+    };
+}
@@ -0,0 +1,107 @@
+// WorkshopCatalog.cpp
+//
+// Collation keys and sorted-catalog helpers declared in WorkshopCatalog.h.
+
+#include "pch.h"
+#include "WorkshopCatalog.h"
+#include <algorithm>
+#include <thread>
+
+namespace ss_catalog {
+
+    namespace {
+        // Below this a single-threaded sort wins over thread start-up.
+        constexpr std::size_t kParallelSortMin = 16 * 1024;
+        // Batches up to this size are inserted one by one.
+        constexpr std::size_t kBinaryInsertMax = 8;
+
+        // Marks the start of a number in a key; below every printable byte so
+        // numbers sort ahead of letters and punctuation.
+        constexpr char kNumber = '\x01';
+
+        bool isDigit(char c) { return c >= '0' && c <= '9'; }
+    }
+
+    std::string collationKey(std::string_view name) {
+        std::string key;
+        key.reserve(name.size() + 4);
+        for (std::size_t i = 0; i < name.size();) {
+            char c = name[i];
+            if (!isDigit(c)) {
+                key += (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+                ++i;
+                continue;
+            }
+            // Digit run: leading zeros dropped, then the digit count ahead of
+            // the digits so a longer number always sorts after a shorter one.
+            std::size_t end = i;
+            while (end < name.size() && isDigit(name[end])) ++end;
+            std::size_t first = i;
+            while (first < end && name[first] == '0') ++first;
+            const std::size_t len = std::min<std::size_t>(end - first, 0xFF);
+            key += kNumber;
+            key += static_cast<char>(len);
+            key.append(name.data() + first, len);
+            i = end;
+        }
+        return key;
+    }
+
+    void assignKeys(std::vector<WorkshopEntry>& entries) {
+        for (auto& e : entries) assignKey(e);
+    }
+
+    void sortEntries(std::vector<WorkshopEntry>& entries) {
+        const std::size_t n = entries.size();
+        unsigned threads = std::thread::hardware_concurrency();
+        if (n < kParallelSortMin || threads < 2) {
+            std::sort(entries.begin(), entries.end(), workshopLess);
+            return;
+        }
+
+        // Power-of-two chunk count so the merge tree is balanced.
+        unsigned chunks = 1;
+        while (chunks * 2 <= std::min(threads, 8u)) chunks *= 2;
+        std::vector<std::size_t> bounds(chunks + 1);
+        for (unsigned i = 0; i <= chunks; ++i) bounds[i] = n * i / chunks;
+
+        auto at = [&](std::size_t i) { return entries.begin() + static_cast<std::ptrdiff_t>(i); };
+        std::vector<std::thread> pool;
+        for (unsigned i = 1; i < chunks; ++i)
+            pool.emplace_back([&, i] { std::sort(at(bounds[i]), at(bounds[i + 1]), workshopLess); });
+        std::sort(at(bounds[0]), at(bounds[1]), workshopLess);
+        for (auto& t : pool) t.join();
+
+        for (unsigned width = 1; width < chunks; width *= 2) {
+            pool.clear();
+            for (unsigned i = 0; i + width < chunks; i += 2 * width) {
+                const std::size_t lo = bounds[i], mid = bounds[i + width];
+                const std::size_t hi = bounds[std::min(i + 2 * width, chunks)];
+                pool.emplace_back([&, lo, mid, hi] { std::inplace_merge(at(lo), at(mid), at(hi), workshopLess); });
+            }
+            for (auto& t : pool) t.join();
+        }
+    }
+
+    void insertSorted(std::vector<WorkshopEntry>& catalog, std::vector<WorkshopEntry>&& added) {
+        if (added.empty()) return;
+        if (added.size() <= kBinaryInsertMax) {
+            for (auto& e : added) {
+                auto pos = std::upper_bound(catalog.begin(), catalog.end(), e, workshopLess);
+                catalog.insert(pos, std::move(e));
+            }
+            added.clear();
+            return;
+        }
+        sortEntries(added);
+        if (catalog.empty()) {
+            catalog.swap(added);
+            return;
+        }
+        const auto mid = catalog.size();
+        catalog.insert(catalog.end(), std::make_move_iterator(added.begin()), std::make_move_iterator(added.end()));
+        std::inplace_merge(catalog.begin(), catalog.begin() + static_cast<std::ptrdiff_t>(mid), catalog.end(), workshopLess);
+        added.clear();
+    }
+
+} // namespace ss_catalog
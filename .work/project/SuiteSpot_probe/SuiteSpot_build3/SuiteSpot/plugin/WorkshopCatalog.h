@@ -0,0 +1,43 @@
+// WorkshopCatalog.h
+//
+// Ordering and maintenance of the sorted workshop catalog (RLWorkshop).
+// Every entry carries a precomputed collation key so comparisons during
+// sorts and merges are plain byte compares: names are case-folded and runs
+// of digits compare by numeric value ("Map 2" < "Map 10"). Keys are built
+// on the thread that produces the entry (scan or watcher thread), never in
+// the render loop.
+
+#pragma once
+
+#include "MapList.h"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ss_catalog {
+
+    // Sort key for a display name. Byte-wise comparison of two keys gives
+    // case-insensitive natural order. ASCII letters are folded; other UTF-8
+    // bytes are kept as-is.
+    std::string collationKey(std::string_view name);
+
+    inline void assignKey(WorkshopEntry& e) { e.sortKey = collationKey(e.name); }
+    void assignKeys(std::vector<WorkshopEntry>& entries);
+
+    // Catalog order: collation key, then raw name, then path, so the order
+    // never depends on walk timing.
+    inline bool workshopLess(const WorkshopEntry& a, const WorkshopEntry& b) {
+        if (int c = a.sortKey.compare(b.sortKey)) return c < 0;
+        if (int c = a.name.compare(b.name)) return c < 0;
+        return a.filePath < b.filePath;
+    }
+
+    // Sorts by workshopLess; large inputs are sorted in parallel chunks
+    // and merged.
+    void sortEntries(std::vector<WorkshopEntry>& entries);
+
+    // Adds `added` (keys assigned, any order) to the sorted `catalog`.
+    // A handful of entries are placed by binary search; larger batches are
+    // sorted and merged in one linear pass.
+    void insertSorted(std::vector<WorkshopEntry>& catalog, std::vector<WorkshopEntry>&& added);
+}
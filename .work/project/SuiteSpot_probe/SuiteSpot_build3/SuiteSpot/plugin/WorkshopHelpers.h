@@ -0,0 +1,188 @@
+// WorkshopHelpers.h
+//
+// Path and workshop-detection helpers shared by SuiteSpot.cpp and the
+// console benchmarks: BakkesMod data folders (ss_paths) and Epic/Steam
+// workshop root detection plus the PowerShell import helpers (ss_epic).
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>            // for std::getenv and system
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <system_error>       // for std::error_code
+#include <vector>
+#include "WorkshopWalker.h"  // parallel directory discovery
+
+namespace ss_paths {
+    namespace fs = std::filesystem;
+
+    inline fs::path epicModsDefault() {
+        const char* up = std::getenv("USERPROFILE");
+        if (!up) return {};
+        return fs::path(up) / "Documents" / "My Games" / "Rocket League" / "TAGame" / "CookedPCConsole" / "mods";
+    }
+
+    inline fs::path steamWorkshopDefault() {
+        const char* sp = std::getenv("PROGRAMFILES(X86)");
+        if (!sp) return {};
+        fs::path base = fs::path(sp) / "Steam" / "steamapps" / "workshop" / "content" / "252950";
+        if (fs::exists(base)) return base;
+        return {};
+    }
+
+    inline fs::path bmDataRoot() {
+        const char* app = std::getenv("APPDATA");
+        if (!app) return {};
+        return fs::path(app) / "bakkesmod" / "bakkesmod" / "data";
+    }
+
+    inline fs::path suiteTrainingDir()  { return bmDataRoot() / "SuiteTraining"; }
+    inline fs::path suiteWorkshopsDir() { return bmDataRoot() / "SuiteWorkshops"; }
+
+    inline void ensureDataDirs(std::error_code& ec) {
+        fs::create_directories(suiteTrainingDir(),  ec);
+        ec.clear();
+        fs::create_directories(suiteWorkshopsDir(), ec);
+    }
+}
+
+// Helper functions for handling Epic/Steam workshop maps and cooked content.
+// These functions are designed to avoid reliance on WorkshopMapLoader and do
+// not probe the user's Documents folder. Instead, they prioritise the
+// BakkesMod data directories and standard Steam workshop paths.
+namespace ss_epic {
+    namespace fs = std::filesystem;
+
+    // Returns true if the given path exists and is a directory.
+    inline bool exists_dir(const fs::path& p) {
+        std::error_code ec;
+        return fs::exists(p, ec) && fs::is_directory(p, ec);
+    }
+
+    // Extensions that look like a workshop map (upk, udk, pak, zip),
+    // compared case-insensitively.
+    inline const ss_walk::ExtensionSet& mapExtensions() {
+        static const ss_walk::ExtensionSet exts{ ".udk", ".upk", ".pak", ".zip" };
+        return exts;
+    }
+
+    inline bool looksLikeMapFile(const fs::path& p) {
+        return mapExtensions().matches(p);
+    }
+
+    // Returns true if the directory contains at least one map file directly or
+    // within its immediate children (one level deep). This avoids scanning
+    // deeply nested directories but is sufficient for our auto-detection.
+    // Subdirectories are probed in parallel and the walk stops at the first hit.
+    inline bool looksLikeMapDir(const fs::path& p) {
+        if (!exists_dir(p)) return false;
+        std::atomic<bool> found{ false };
+        ss_walk::ScanSpec spec;
+        spec.match = mapExtensions();
+        spec.maxDepth = 1;
+        ss_walk::scan({ p }, spec, [&](ss_walk::Listing& l) {
+            if (l.files.empty()) return true;
+            found = true;
+            return false;
+        });
+        return found;
+    }
+
+    // Build a list of candidate directories where workshop maps may reside.
+    // The order is: SuiteSpot's own data folders, generic 'Workshop' folder
+    // within BakkesMod data, and Steam workshop content for Rocket League.
+    inline std::vector<fs::path> candidateFolders() {
+        std::vector<fs::path> cand;
+        const char* app = std::getenv("APPDATA");
+        if (app) {
+            fs::path dataRoot = fs::path(app) / "bakkesmod" / "bakkesmod" / "data";
+            cand.push_back(dataRoot / "SuiteWorkshops");
+            cand.push_back(dataRoot / "Workshop");
+        }
+        const char* pf86 = std::getenv("PROGRAMFILES(X86)");
+        if (pf86) {
+            fs::path base = fs::path(pf86) / "Steam" / "steamapps" / "workshop" / "content" / "252950";
+            cand.push_back(base);
+            // Attempt to parse additional Steam library folders from libraryfolders.vdf
+            fs::path vdf = fs::path(pf86) / "Steam" / "steamapps" / "libraryfolders.vdf";
+            std::error_code ec;
+            if (fs::exists(vdf, ec) && fs::is_regular_file(vdf, ec)) {
+                std::ifstream in(vdf.string());
+                std::string line;
+                while (std::getline(in, line)) {
+                    auto pos = line.find("\"path\"");
+                    if (pos == std::string::npos) continue;
+                    auto q1 = line.find('"', pos + 6);
+                    if (q1 == std::string::npos) continue;
+                    auto q2 = line.find('"', q1 + 1);
+                    if (q2 == std::string::npos) continue;
+                    std::string p = line.substr(q1 + 1, q2 - (q1 + 1));
+                    fs::path lib = fs::path(p) / "steamapps" / "workshop" / "content" / "252950";
+                    cand.push_back(lib);
+                }
+            }
+        }
+        return cand;
+    }
+
+    // Attempt to detect a workshop root directory by iterating candidate
+    // directories. If a directory contains recognizable map files, it is
+    // returned. If none match, an empty path is returned.
+    inline fs::path detectWorkshopRoot(const std::vector<fs::path>& candidates) {
+        for (const auto& c : candidates) {
+            if (looksLikeMapDir(c)) return c;
+        }
+        return {};
+    }
+
+    inline fs::path detectWorkshopRoot() { return detectWorkshopRoot(candidateFolders()); }
+
+    // Check if essential cooked texture files exist in the cooked folder. This
+    // matches the file list typically used by WorkshopMapLoader to determine
+    // whether textures are installed. The list is intentionally conservative.
+    inline bool texturesInstalled(const fs::path& cooked) {
+        static const char* required[] = {
+            "mods.upk",
+            "Engine_MI_Shaders.upk",
+            "EngineBuildings.upk",
+            "EngineDebugMaterials.upk",
+            "MapTemplates.upk",
+            "MapTemplateIndex.upk",
+            "NodeBuddies.upk"
+        };
+        for (auto* file : required) {
+            if (!exists_dir(cooked)) return false;
+            std::error_code ec;
+            if (!fs::exists(cooked / file, ec)) return false;
+        }
+        return true;
+    }
+
+    // Expand a zip archive into the destination directory using PowerShell. The
+    // -Force flag overwrites existing files. This helper spawns a shell via
+    // system() and therefore blocks until completion. It assumes
+    // powershell.exe is available on the system.
+    inline void ps_expand_zip(const std::string& zipPath, const fs::path& dest) {
+        // Ensure destination directory exists
+        std::error_code ec;
+        fs::create_directories(dest, ec);
+        // Build and execute the PowerShell command
+        std::string cmd = std::string("powershell.exe -NoProfile -ExecutionPolicy Bypass -Command \"") +
+                          "Expand-Archive -LiteralPath '" + zipPath + "' -DestinationPath '" + dest.string() + "' -Force\"";
+        std::system(cmd.c_str());
+    }
+
+    // Download a file from a URL using PowerShell Invoke-WebRequest and save
+    // it to the specified output file. Returns true on success. If PowerShell
+    // fails for any reason, false is returned. Note: this function relies on
+    // an outbound connection and may fail silently if network access is not
+    // available.
+    inline bool ps_download_to(const std::string& url, const std::string& outFile) {
+        std::string cmd = std::string("powershell.exe -NoProfile -ExecutionPolicy Bypass -Command \"") +
+                          "Invoke-WebRequest -Uri '" + url + "' -OutFile '" + outFile + "' -UseBasicParsing\"";
+        int code = std::system(cmd.c_str());
+        return code == 0;
+    }
+} // namespace ss_epic
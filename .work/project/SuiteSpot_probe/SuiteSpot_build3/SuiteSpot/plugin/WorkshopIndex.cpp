@@ -0,0 +1,286 @@
+// WorkshopIndex.cpp
+//
+// Implementation of the persistent workshop index declared in
+// WorkshopIndex.h. The on-disk format is plain text, one record per line,
+// with tab-separated fields:
+//
+//     SSIDX<TAB>1
+//     D<TAB><mtime><TAB><dir path>
+//     F<TAB><size><TAB><mtime><TAB><json mtime><TAB><file path><TAB><title>
+//
+// Directory contents are not stored explicitly; they are rebuilt on load
+// from the parent path of each D and F record.
+
+#include "pch.h"
+#include "WorkshopIndex.h"
+#include "JsonTitle.h"
+#include "WorkshopWalker.h"
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <system_error>
+
+namespace ss_index {
+
+    static constexpr const char* kMagic = "SSIDX";
+    static constexpr int kVersion = 1;
+
+    // Titles come from user-editable json; keep them on one index line.
+    static std::string sanitizeField(std::string s) {
+        for (auto& c : s) if (c == '\t' || c == '\n' || c == '\r') c = ' ';
+        return s;
+    }
+
+    static std::vector<std::string> splitTabs(const std::string& line) {
+        std::vector<std::string> parts;
+        size_t start = 0;
+        while (true) {
+            auto pos = line.find('\t', start);
+            if (pos == std::string::npos) { parts.push_back(line.substr(start)); break; }
+            parts.push_back(line.substr(start, pos - start));
+            start = pos + 1;
+        }
+        return parts;
+    }
+
+    std::string resolveDisplayName(const fs::path& mapFile, const fs::path& sidecar) {
+        // Pretty name: json title > parent folder > stem
+        std::string display = mapFile.stem().string();
+        fs::path parent = mapFile.parent_path().filename();
+        if (!parent.empty()) display = parent.string();
+        if (!sidecar.empty()) {
+            auto t = ss_json::readTitle(sidecar);
+            if (!t.empty()) display = t;
+        }
+        return display;
+    }
+
+    std::string resolveDisplayName(const fs::path& mapFile) {
+        fs::path jsonPath = mapFile;
+        jsonPath.replace_extension(".json");
+        std::error_code ec;
+        if (!fs::exists(jsonPath, ec) || ec) jsonPath.clear();
+        return resolveDisplayName(mapFile, jsonPath);
+    }
+
+    void WorkshopIndex::load(const fs::path& file) {
+        file_ = file;
+        loaded_ = true;
+        dirty_ = false;
+        dirs_.clear();
+        files_.clear();
+
+        std::ifstream in(file_.string());
+        if (!in.is_open()) return;
+        std::string line;
+        if (!std::getline(in, line)) return;
+        auto header = splitTabs(line);
+        if (header.size() != 2 || header[0] != kMagic || header[1] != std::to_string(kVersion)) return;
+
+        try {
+            while (std::getline(in, line)) {
+                if (line.empty()) continue;
+                auto f = splitTabs(line);
+                if (f[0] == "D" && f.size() == 3) {
+                    dirs_[f[2]].mtime = std::stoll(f[1]);
+                } else if (f[0] == "F" && f.size() == 6) {
+                    FileRecord r;
+                    r.size = std::stoull(f[1]);
+                    r.mtime = std::stoll(f[2]);
+                    r.jsonMtime = std::stoll(f[3]);
+                    r.title = f[5];
+                    files_[f[4]] = std::move(r);
+                }
+            }
+        } catch (const std::exception&) {
+            // Corrupt index: start over rather than trust partial data.
+            dirs_.clear();
+            files_.clear();
+            return;
+        }
+
+        // Rebuild directory membership from the flat records.
+        for (const auto& [path, rec] : files_) {
+            auto it = dirs_.find(fs::path(path).parent_path().string());
+            if (it != dirs_.end()) it->second.files.push_back(path);
+        }
+        for (auto& [path, rec] : dirs_) {
+            auto it = dirs_.find(fs::path(path).parent_path().string());
+            if (it != dirs_.end() && it->first != path) it->second.subdirs.push_back(path);
+        }
+    }
+
+    void WorkshopIndex::save() {
+        if (!dirty_ || file_.empty()) return;
+        std::error_code ec;
+        fs::create_directories(file_.parent_path(), ec);
+        fs::path tmp = file_;
+        tmp += ".tmp";
+        {
+            std::ofstream out(tmp.string(), std::ios::trunc);
+            if (!out.is_open()) return;
+            out << kMagic << '\t' << kVersion << '\n';
+            for (const auto& [path, rec] : dirs_) {
+                out << "D\t" << rec.mtime << '\t' << path << '\n';
+            }
+            for (const auto& [path, rec] : files_) {
+                out << "F\t" << rec.size << '\t' << rec.mtime << '\t' << rec.jsonMtime << '\t'
+                    << path << '\t' << sanitizeField(rec.title) << '\n';
+            }
+            if (!out) return;
+        }
+        fs::rename(tmp, file_, ec);
+        if (ec) { fs::remove(tmp, ec); return; }
+        dirty_ = false;
+    }
+
+    namespace {
+        // Everything learned about one directory during a scan. Built on a
+        // walker thread, merged into the index on the calling thread.
+        struct DirResult {
+            std::string key;
+            DirRecord rec;
+            std::vector<std::pair<std::string, FileRecord>> files;
+            std::size_t hits = 0;
+            std::size_t misses = 0;
+            bool relisted = false;
+            bool stale = false;
+        };
+    }
+
+    void WorkshopIndex::scan(const std::vector<fs::path>& roots, std::vector<WorkshopEntry>& out) {
+        std::mutex m;
+        std::vector<std::pair<std::string, std::vector<WorkshopEntry>>> byDir;
+        scan(roots, [&](std::vector<WorkshopEntry>&& batch) {
+            std::string dir = fs::path(batch.front().filePath).parent_path().string();
+            std::lock_guard<std::mutex> lk(m);
+            byDir.emplace_back(std::move(dir), std::move(batch));
+        });
+        std::sort(byDir.begin(), byDir.end(),
+                  [](const auto& a, const auto& b) { return a.first < b.first; });
+        for (auto& [dir, batch] : byDir) {
+            out.insert(out.end(), std::make_move_iterator(batch.begin()), std::make_move_iterator(batch.end()));
+        }
+    }
+
+    bool WorkshopIndex::scan(const std::vector<fs::path>& roots, const BatchSink& sink,
+                             const std::atomic<bool>* cancel) {
+        stats_ = {};
+        auto cancelled = [cancel] { return cancel && cancel->load(std::memory_order_relaxed); };
+
+        std::mutex resultsMutex;
+        std::vector<DirResult> results;
+
+        // Both callbacks run concurrently on walker threads; dirs_ and files_
+        // are only read here.
+        auto finish = [&](DirResult& r) {
+            if (!r.files.empty()) {
+                std::vector<WorkshopEntry> batch;
+                batch.reserve(r.files.size());
+                for (const auto& [path, rec] : r.files) batch.push_back({ path, rec.title });
+                sink(std::move(batch));
+            }
+            std::lock_guard<std::mutex> lk(resultsMutex);
+            results.push_back(std::move(r));
+        };
+
+        static const ss_walk::ExtensionSet kMapOrSidecar{ ".upk", ".json" };
+        static const ss_walk::ExtensionSet kSidecar{ ".json" };
+
+        ss_walk::ScanSpec spec;
+        spec.match = kMapOrSidecar;
+
+        // Directory unchanged since the last scan: trust its cached listing
+        // and titles without touching the disk again.
+        spec.reuse = [&](const fs::directory_entry& dir, std::int64_t mtime, std::size_t, int,
+                         std::vector<fs::path>& subdirs) {
+            if (cancelled()) return true; // skip without descending; the scan is winding down
+            auto cached = dirs_.find(dir.path().string());
+            if (cached == dirs_.end() || cached->second.mtime != mtime) return false;
+
+            DirResult r;
+            r.key = cached->first;
+            r.rec = cached->second;
+            for (const auto& path : r.rec.files) {
+                auto hit = files_.find(path);
+                if (hit == files_.end()) { r.stale = true; continue; }
+                ++r.hits;
+                r.files.emplace_back(path, hit->second);
+            }
+            // Index out of sync with itself; relist next time.
+            if (r.stale) r.rec.mtime = 0;
+            for (const auto& sub : r.rec.subdirs) subdirs.emplace_back(sub);
+            finish(r);
+            return true;
+        };
+
+        // New or modified directory: the engine has listed it once; take
+        // size and mtime of each map from that listing.
+        auto onDir = [&](ss_walk::Listing& l) {
+            if (cancelled()) return false;
+            DirResult r;
+            r.key = l.dir.path().string();
+            r.relisted = true;
+            r.rec.mtime = l.mtime;
+            for (const auto& sub : l.subdirs) r.rec.subdirs.push_back(sub.path().string());
+
+            struct Sidecar { fs::path path; std::int64_t mtime = 0; };
+            std::unordered_map<std::string, Sidecar> sidecars; // stem -> json
+            std::vector<const fs::directory_entry*> maps;
+            for (const auto& entry : l.files) {
+                if (!kSidecar(entry)) { maps.push_back(&entry); continue; }
+                std::uintmax_t size = 0;
+                std::int64_t mtime = 0;
+                if (ss_walk::fileMeta(entry, size, mtime))
+                    sidecars[entry.path().stem().string()] = { entry.path(), mtime };
+            }
+
+            for (const auto* entry : maps) {
+                std::string path = entry->path().string();
+                FileRecord fresh;
+                if (!ss_walk::fileMeta(*entry, fresh.size, fresh.mtime)) { fresh.size = 0; fresh.mtime = 0; }
+                auto sc = sidecars.find(entry->path().stem().string());
+                fresh.jsonMtime = sc == sidecars.end() ? 0 : sc->second.mtime;
+
+                auto old = files_.find(path);
+                if (old != files_.end() && old->second.size == fresh.size &&
+                    old->second.mtime == fresh.mtime && old->second.jsonMtime == fresh.jsonMtime) {
+                    ++r.hits;
+                    fresh.title = old->second.title;
+                } else {
+                    ++r.misses;
+                    fresh.title = resolveDisplayName(entry->path(), sc == sidecars.end() ? fs::path() : sc->second.path);
+                }
+                r.rec.files.push_back(path);
+                r.files.emplace_back(std::move(path), std::move(fresh));
+            }
+            finish(r);
+            return !cancelled();
+        };
+        ss_walk::scan(roots, spec, onDir);
+        if (cancelled()) return false;
+
+        // Merge in path order so the index does not depend on thread timing.
+        std::sort(results.begin(), results.end(),
+                  [](const DirResult& a, const DirResult& b) { return a.key < b.key; });
+
+        std::unordered_map<std::string, DirRecord>  nextDirs;
+        std::unordered_map<std::string, FileRecord> nextFiles;
+        for (auto& r : results) {
+            ++stats_.dirsVisited;
+            if (r.relisted) ++stats_.dirsRelisted;
+            if (r.relisted || r.stale) dirty_ = true;
+            stats_.titleHits += r.hits;
+            stats_.titleMisses += r.misses;
+            for (auto& [path, rec] : r.files) nextFiles[path] = std::move(rec);
+            nextDirs[r.key] = std::move(r.rec);
+        }
+
+        // Anything not reached this time (deleted dirs, removed roots) drops out.
+        if (nextDirs.size() != dirs_.size() || nextFiles.size() != files_.size()) dirty_ = true;
+        dirs_ = std::move(nextDirs);
+        files_ = std::move(nextFiles);
+        return true;
+    }
+
+} // namespace ss_index
@@ -0,0 +1,95 @@
+// WorkshopIndex.h
+//
+// Persistent, incremental index of discovered workshop maps. The index is
+// stored under `%AppData%/bakkesmod/bakkesmod/data/SuiteWorkshops` and
+// remembers every map file (path, size, mtime, resolved display title) and
+// the mtime of every directory visited during the last scan. A rescan only
+// lists directories whose mtime changed; unchanged directories are served
+// straight from the cache, and titles are reused for map files whose size
+// and mtime still match.
+
+#pragma once
+
+#include "MapList.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ss_index {
+    namespace fs = std::filesystem;
+
+    // A cached map file. Times are ss_walk::fileMeta ticks; the index is
+    // only ever read back on the machine that wrote it.
+    struct FileRecord {
+        std::uintmax_t size = 0;
+        std::int64_t   mtime = 0;
+        std::int64_t   jsonMtime = 0; // sidecar .json mtime, 0 if none
+        std::string    title;
+    };
+
+    // A cached directory: its mtime when last listed, plus the map files and
+    // subdirectories it contained at that time (full paths).
+    struct DirRecord {
+        std::int64_t mtime = 0;
+        std::vector<std::string> files;
+        std::vector<std::string> subdirs;
+    };
+
+    // Counters for the most recent scan. A title hit means the display name
+    // came from the index; a miss means it had to be resolved from disk.
+    struct ScanStats {
+        std::size_t dirsVisited = 0;
+        std::size_t dirsRelisted = 0;
+        std::size_t titleHits = 0;
+        std::size_t titleMisses = 0;
+    };
+
+    // Resolves the display name of a map file: sidecar json title, then
+    // parent folder name, then file stem.
+    std::string resolveDisplayName(const fs::path& mapFile);
+
+    // Same, for callers that already listed the directory; an empty
+    // `sidecar` means the map has no json and nothing is probed on disk.
+    std::string resolveDisplayName(const fs::path& mapFile, const fs::path& sidecar);
+
+    class WorkshopIndex {
+    public:
+        // Reads the index file. A missing or unreadable file simply leaves
+        // the index empty so the next scan rebuilds it.
+        void load(const fs::path& file);
+
+        // Writes the index back if the last scan changed anything. The file
+        // is written to a temporary sibling and renamed into place.
+        void save();
+
+        // Receives the map entries of one directory as soon as they are
+        // known. Called concurrently from walker threads.
+        using BatchSink = std::function<void(std::vector<WorkshopEntry>&& batch)>;
+
+        // Walks the given roots with ss_walk::scan (see WorkshopWalker.h), streaming
+        // one WorkshopEntry per map file to `sink`. Roots that do not exist
+        // are skipped. If `cancel` becomes true the walk stops early, the
+        // index is left as it was and false is returned.
+        bool scan(const std::vector<fs::path>& roots, const BatchSink& sink,
+                  const std::atomic<bool>* cancel = nullptr);
+
+        // Blocking convenience overload; `out` is filled in directory path order.
+        void scan(const std::vector<fs::path>& roots, std::vector<WorkshopEntry>& out);
+
+        bool isLoaded() const { return loaded_; }
+        const ScanStats& lastStats() const { return stats_; }
+
+    private:
+        fs::path file_;
+        bool loaded_ = false;
+        bool dirty_ = false;
+        std::unordered_map<std::string, DirRecord>  dirs_;
+        std::unordered_map<std::string, FileRecord> files_;
+        ScanStats stats_;
+    };
+}
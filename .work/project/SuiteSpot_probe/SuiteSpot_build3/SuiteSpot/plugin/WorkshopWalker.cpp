@@ -0,0 +1,219 @@
+// WorkshopWalker.cpp
+//
+// Work-stealing implementation of ss_walk::scan. Each worker owns a deque:
+// it pushes and pops its own work at the back (depth-first, cache friendly)
+// and steals from the front of other workers' deques (breadth-first, so a
+// thief takes large unexplored subtrees rather than leaves).
+
+#include "pch.h"
+#include "WorkshopWalker.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cwctype>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#if !defined(_WIN32)
+#include <sys/stat.h>
+#endif
+
+namespace ss_walk {
+
+    namespace {
+        struct Task {
+            fs::directory_entry dir;
+            std::size_t root = 0;
+            int depth = 0;
+        };
+
+        struct WorkQueue {
+            std::mutex m;
+            std::deque<Task> q;
+        };
+
+        template <typename C>
+        C lowerChar(C c) {
+            if constexpr (sizeof(C) == 1) return (C)std::tolower((unsigned char)c);
+            else return (C)std::towlower((std::wint_t)c);
+        }
+    }
+
+    ExtensionSet::ExtensionSet(std::initializer_list<const char*> exts) {
+        for (const char* e : exts) {
+            fs::path::string_type s;
+            if (*e != '.') s.push_back('.');
+            for (; *e; ++e) s.push_back(lowerChar((fs::path::value_type)*e));
+            exts_.push_back(std::move(s));
+        }
+    }
+
+    bool ExtensionSet::matches(const fs::path& p) const {
+        const auto& name = p.native();
+        for (const auto& ext : exts_) {
+            if (name.size() <= ext.size()) continue;
+            const auto off = name.size() - ext.size();
+            bool eq = true;
+            for (std::size_t i = 0; i < ext.size() && eq; ++i) eq = lowerChar(name[off + i]) == ext[i];
+            if (eq) return true;
+        }
+        return false;
+    }
+
+    Counters& counters() {
+        static Counters c;
+        return c;
+    }
+
+    bool fileMeta(const fs::directory_entry& e, std::uintmax_t& size, std::int64_t& mtime) {
+#if defined(_WIN32)
+        // MSVC's directory_iterator caches size and write time from
+        // FindNextFileW, so neither call touches the disk.
+        std::error_code ec;
+        size = e.is_directory(ec) ? 0 : e.file_size(ec);
+        if (ec) return false;
+        auto t = e.last_write_time(ec);
+        if (ec) return false;
+        mtime = static_cast<std::int64_t>(t.time_since_epoch().count());
+        return true;
+#else
+        // Other standard libraries stat once per query; do a single stat for both.
+        ++counters().stats;
+        struct stat st;
+        if (::stat(e.path().c_str(), &st) != 0) return false;
+        size = S_ISDIR(st.st_mode) ? 0 : static_cast<std::uintmax_t>(st.st_size);
+        mtime = static_cast<std::int64_t>(st.st_mtim.tv_sec) * 1000000000 + st.st_mtim.tv_nsec;
+        return true;
+#endif
+    }
+
+    unsigned defaultThreads() {
+        unsigned hw = std::thread::hardware_concurrency();
+        if (hw == 0) hw = 2;
+        return std::clamp(hw, 2u, 8u);
+    }
+
+    void scan(const std::vector<fs::path>& roots, const ScanSpec& spec, const ListingHandler& onDir) {
+        auto& ctr = counters();
+        std::vector<Task> seeds;
+        for (std::size_t i = 0; i < roots.size(); ++i) {
+            std::error_code ec;
+            ++ctr.stats;
+            fs::directory_entry d(roots[i], ec);
+            if (!ec && d.is_directory(ec) && !ec) seeds.push_back({ std::move(d), i, 0 });
+        }
+        if (seeds.empty()) return;
+
+        const unsigned n = std::max(1u, spec.threads ? spec.threads : defaultThreads());
+        std::vector<WorkQueue> queues(n);
+        std::atomic<std::size_t> outstanding{ 0 };
+        std::atomic<bool> stop{ false };
+
+        // Spread roots across workers so Epic and Steam start in parallel.
+        for (std::size_t i = 0; i < seeds.size(); ++i) {
+            queues[i % n].q.push_back(std::move(seeds[i]));
+            ++outstanding;
+        }
+
+        auto process = [&](Task& t, std::vector<Task>& next) -> bool {
+            const bool descend = spec.maxDepth < 0 || t.depth < spec.maxDepth;
+
+            std::int64_t mtime = 0;
+            if (spec.reuse) {
+                std::uintmax_t size = 0;
+                if (!fileMeta(t.dir, size, mtime)) return true; // vanished mid-scan
+            }
+            std::vector<fs::path> reused;
+            if (spec.reuse && spec.reuse(t.dir, mtime, t.root, t.depth, reused)) {
+                if (!descend) return true;
+                for (auto& p : reused) {
+                    std::error_code ec;
+                    ++ctr.stats;
+                    fs::directory_entry d(p, ec);
+                    if (!ec) next.push_back({ std::move(d), t.root, t.depth + 1 });
+                }
+                return true;
+            }
+
+            Listing l;
+            l.root = t.root;
+            l.depth = t.depth;
+            l.mtime = mtime;
+            ++ctr.dirsListed;
+            std::error_code ec;
+            for (fs::directory_iterator it(t.dir.path(), fs::directory_options::skip_permission_denied, ec), end;
+                 it != end; it.increment(ec)) {
+                if (ec) break;
+                ++ctr.entriesSeen;
+                const auto& e = *it;
+                std::error_code sec;
+                if (e.is_symlink(sec)) {
+                    // Directory links are never followed; a file link costs one stat.
+                    ++ctr.stats;
+                    if (e.is_regular_file(sec) && (!spec.match || spec.match(e))) l.files.push_back(e);
+                    continue;
+                }
+                if (e.is_directory(sec)) {
+                    if (descend) l.subdirs.push_back(e);
+                } else if (e.is_regular_file(sec) && (!spec.match || spec.match(e))) {
+                    l.files.push_back(e);
+                }
+            }
+            l.dir = std::move(t.dir);
+
+            bool keepGoing = onDir(l);
+            for (auto& d : l.subdirs) next.push_back({ std::move(d), l.root, l.depth + 1 });
+            return keepGoing;
+        };
+
+        auto worker = [&](unsigned self) {
+            std::vector<Task> next;
+            while (!stop.load(std::memory_order_relaxed)) {
+                Task t;
+                bool got = false;
+                {
+                    std::lock_guard<std::mutex> lk(queues[self].m);
+                    auto& q = queues[self].q;
+                    if (!q.empty()) { t = std::move(q.back()); q.pop_back(); got = true; }
+                }
+                for (unsigned k = 1; !got && k < n; ++k) {
+                    auto& victim = queues[(self + k) % n];
+                    std::lock_guard<std::mutex> lk(victim.m);
+                    if (!victim.q.empty()) { t = std::move(victim.q.front()); victim.q.pop_front(); got = true; }
+                }
+                if (!got) {
+                    if (outstanding.load(std::memory_order_acquire) == 0) break;
+                    // Someone is still listing a directory that may produce work.
+                    std::this_thread::sleep_for(std::chrono::microseconds(100));
+                    continue;
+                }
+
+                next.clear();
+                bool keepGoing = true;
+                try {
+                    keepGoing = process(t, next);
+                } catch (...) {
+                    // A bad entry (e.g. an unconvertible filename) must not
+                    // take the game down from a worker thread; skip the dir.
+                    next.clear();
+                }
+                if (!keepGoing) stop.store(true, std::memory_order_relaxed);
+
+                if (!next.empty()) {
+                    outstanding.fetch_add(next.size(), std::memory_order_relaxed);
+                    std::lock_guard<std::mutex> lk(queues[self].m);
+                    for (auto& nt : next) queues[self].q.push_back(std::move(nt));
+                }
+                outstanding.fetch_sub(1, std::memory_order_acq_rel);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        pool.reserve(n - 1);
+        for (unsigned i = 1; i < n; ++i) pool.emplace_back(worker, i);
+        worker(0);
+        for (auto& th : pool) th.join();
+    }
+
+} // namespace ss_walk
@@ -0,0 +1,94 @@
+// WorkshopWalker.h
+//
+// Shared scan engine for every workshop directory walk (catalog scan,
+// DiscoverWorkshopInDir, workshop root detection). Directories are handed
+// out as tasks to a small pool of worker threads; each worker keeps its own
+// queue and steals from the others when it runs dry, so a deep Steam tree
+// and a flat Epic mods folder can be walked at the same time without one
+// starving the other.
+//
+// The engine lists each directory exactly once and classifies entries from
+// the type information the directory listing already carries, so plain
+// files and directories cost no extra stat. Which files are reported is
+// decided by a pluggable match predicate; how deep to go by a depth limit.
+// Handlers run concurrently and must synchronise any shared output;
+// callers that need a stable result order should sort after scan() returns.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+namespace ss_walk {
+    namespace fs = std::filesystem;
+
+    // Case-insensitive extension matcher ("upk" or ".upk" both accepted).
+    // Compares in place on the native filename, no per-entry allocation.
+    class ExtensionSet {
+    public:
+        ExtensionSet(std::initializer_list<const char*> exts);
+        bool operator()(const fs::directory_entry& e) const { return matches(e.path()); }
+        bool matches(const fs::path& p) const;
+    private:
+        std::vector<fs::path::string_type> exts_; // lower-case, with leading dot
+    };
+
+    // Everything the engine found in one directory.
+    struct Listing {
+        fs::directory_entry dir;
+        std::size_t root = 0;   // index into the roots passed to scan()
+        int depth = 0;          // 0 for a root
+        std::int64_t mtime = 0; // directory mtime, only filled when ScanSpec::reuse is set
+        std::vector<fs::directory_entry> files;   // regular files accepted by ScanSpec::match
+        std::vector<fs::directory_entry> subdirs; // handler may prune before returning
+    };
+
+    struct ScanSpec {
+        // Which regular files to report. Null reports every file.
+        std::function<bool(const fs::directory_entry&)> match;
+        int maxDepth = -1;      // -1 = unlimited; 0 = roots only
+        unsigned threads = 0;   // 0 = defaultThreads()
+
+        // Optional cache hook, called with the directory's mtime before it
+        // is listed. Return true to skip listing it; `subdirs` then names the
+        // directories to descend into. Return false to list it normally.
+        std::function<bool(const fs::directory_entry& dir, std::int64_t mtime, std::size_t root,
+                           int depth, std::vector<fs::path>& subdirs)> reuse;
+    };
+
+    // Called once per listed directory, possibly from several threads at
+    // once. Return false to stop the whole scan early.
+    using ListingHandler = std::function<bool(Listing& listing)>;
+
+    // Filesystem work done by the engine since the last reset. `stats`
+    // counts metadata queries that could not be answered from the listing
+    // (roots, cache-reused directories, followed symlinks, fileMeta on
+    // platforms without cached metadata).
+    struct Counters {
+        std::atomic<std::uint64_t> dirsListed{ 0 };
+        std::atomic<std::uint64_t> entriesSeen{ 0 };
+        std::atomic<std::uint64_t> stats{ 0 };
+        void reset() { dirsListed = 0; entriesSeen = 0; stats = 0; }
+    };
+    Counters& counters();
+
+    // Size and mtime of a listed entry (directories report size 0). Served
+    // from the directory listing where the platform caches it (Windows),
+    // otherwise one stat for both values. Mtime units are platform ticks,
+    // only meant to be compared with other fileMeta results.
+    bool fileMeta(const fs::directory_entry& e, std::uintmax_t& size, std::int64_t& mtime);
+
+    // Number of workers used when ScanSpec::threads is 0. Directory listing
+    // is mostly I/O bound, so this is not capped at the core count alone.
+    unsigned defaultThreads();
+
+    // Scans all roots, blocking until every reachable directory has been
+    // handled or a handler asked to stop. Roots that do not exist or are
+    // not directories are skipped.
+    void scan(const std::vector<fs::path>& roots, const ScanSpec& spec, const ListingHandler& onDir);
+}
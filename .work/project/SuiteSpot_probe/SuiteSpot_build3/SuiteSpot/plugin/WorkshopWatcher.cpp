@@ -0,0 +1,308 @@
+// WorkshopWatcher.cpp
+//
+// Implementation of ss_watch::Watcher and its platform backends. The
+// Windows backend uses one overlapped ReadDirectoryChangesW per root with
+// subtree watching. The Linux backend (used for testing) uses inotify,
+// which is not recursive, so it adds a watch per directory and follows new
+// directories as they appear.
+
+#include "pch.h"
+#include "WorkshopWatcher.h"
+#include <string>
+#include <system_error>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#include <windows.h>
+#elif defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace ss_watch {
+
+#if defined(_WIN32)
+
+    namespace {
+        class Win32Backend final : public Backend {
+        public:
+            ~Win32Backend() override {
+                for (auto& r : roots_) {
+                    // The cancelled read still owns ov and the buffer until it
+                    // completes (normally with ERROR_OPERATION_ABORTED), so wait
+                    // for it before freeing them. ERROR_NOT_FOUND: none pending.
+                    if (CancelIoEx(r->dir, &r->ov) || GetLastError() != ERROR_NOT_FOUND) {
+                        DWORD bytes = 0;
+                        GetOverlappedResult(r->dir, &r->ov, &bytes, TRUE);
+                    }
+                    CloseHandle(r->dir);
+                    CloseHandle(r->ov.hEvent);
+                }
+            }
+
+            bool addRoot(const fs::path& root) override {
+                HANDLE dir = CreateFileW(root.c_str(), FILE_LIST_DIRECTORY,
+                    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                    FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+                if (dir == INVALID_HANDLE_VALUE) return false;
+                auto r = std::make_unique<Root>();
+                r->path = root;
+                r->dir = dir;
+                r->ov.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+                if (!r->ov.hEvent || !issue(*r)) {
+                    if (r->ov.hEvent) CloseHandle(r->ov.hEvent);
+                    CloseHandle(dir);
+                    return false;
+                }
+                roots_.push_back(std::move(r));
+                return true;
+            }
+
+            void poll(std::vector<Event>& out, int timeoutMs) override {
+                if (roots_.empty()) { Sleep(timeoutMs); return; }
+                std::vector<HANDLE> events;
+                for (auto& r : roots_) events.push_back(r->ov.hEvent);
+                DWORD w = WaitForMultipleObjects((DWORD)events.size(), events.data(), FALSE, (DWORD)timeoutMs);
+                if (w == WAIT_TIMEOUT || w == WAIT_FAILED) return;
+                // Several roots may be ready; drain every signalled one.
+                for (auto& r : roots_) {
+                    if (WaitForSingleObject(r->ov.hEvent, 0) != WAIT_OBJECT_0) continue;
+                    DWORD bytes = 0;
+                    if (!GetOverlappedResult(r->dir, &r->ov, &bytes, FALSE) || bytes == 0) {
+                        // Buffer overflow (or a transient error): changes were lost.
+                        out.push_back({ Event::Kind::Overflow, r->path });
+                    } else {
+                        parse(*r, bytes, out);
+                    }
+                    ResetEvent(r->ov.hEvent);
+                    if (!issue(*r)) out.push_back({ Event::Kind::Overflow, r->path });
+                }
+            }
+
+        private:
+            struct Root {
+                fs::path path;
+                HANDLE dir = INVALID_HANDLE_VALUE;
+                OVERLAPPED ov{};
+                alignas(DWORD) BYTE buf[64 * 1024];
+            };
+
+            static bool issue(Root& r) {
+                return ReadDirectoryChangesW(r.dir, r.buf, sizeof(r.buf), TRUE,
+                    FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME |
+                    FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE,
+                    nullptr, &r.ov, nullptr) != FALSE;
+            }
+
+            static void parse(const Root& r, DWORD bytes, std::vector<Event>& out) {
+                const BYTE* p = r.buf;
+                const BYTE* end = r.buf + bytes;
+                while (p < end) {
+                    auto* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(p);
+                    std::wstring name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                    Event e;
+                    e.path = r.path / name;
+                    switch (info->Action) {
+                    case FILE_ACTION_ADDED:            e.kind = Event::Kind::Added; break;
+                    case FILE_ACTION_REMOVED:          e.kind = Event::Kind::Removed; break;
+                    case FILE_ACTION_RENAMED_OLD_NAME: e.kind = Event::Kind::RenamedFrom; break;
+                    case FILE_ACTION_RENAMED_NEW_NAME: e.kind = Event::Kind::RenamedTo; break;
+                    default:                           e.kind = Event::Kind::Modified; break;
+                    }
+                    out.push_back(std::move(e));
+                    if (info->NextEntryOffset == 0) break;
+                    p += info->NextEntryOffset;
+                }
+            }
+
+            std::vector<std::unique_ptr<Root>> roots_;
+        };
+    }
+
+    std::unique_ptr<Backend> makeBackend() { return std::make_unique<Win32Backend>(); }
+
+#elif defined(__linux__)
+
+    namespace {
+        class InotifyBackend final : public Backend {
+        public:
+            InotifyBackend() : fd_(inotify_init1(IN_NONBLOCK | IN_CLOEXEC)) {}
+            ~InotifyBackend() override { if (fd_ >= 0) close(fd_); }
+
+            bool addRoot(const fs::path& root) override {
+                if (fd_ < 0) return false;
+                return addTree(root);
+            }
+
+            void poll(std::vector<Event>& out, int timeoutMs) override {
+                pollfd pfd{ fd_, POLLIN, 0 };
+                if (::poll(&pfd, 1, timeoutMs) <= 0) return;
+                alignas(inotify_event) char buf[64 * 1024];
+                while (true) {
+                    ssize_t n = read(fd_, buf, sizeof(buf));
+                    if (n <= 0) break;
+                    for (char* p = buf; p < buf + n; ) {
+                        auto* ev = reinterpret_cast<inotify_event*>(p);
+                        p += sizeof(inotify_event) + ev->len;
+                        handle(*ev, out);
+                    }
+                }
+            }
+
+        private:
+            static constexpr uint32_t kMask = IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE |
+                                              IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF;
+
+            bool addTree(const fs::path& dir) {
+                int wd = inotify_add_watch(fd_, dir.c_str(), kMask | IN_ONLYDIR);
+                if (wd < 0) return false;
+                wds_[wd] = dir;
+                std::error_code ec;
+                for (fs::recursive_directory_iterator it(dir, fs::directory_options::skip_permission_denied, ec), end;
+                     it != end; it.increment(ec)) {
+                    if (ec) break;
+                    if (it->is_directory(ec) && !it->is_symlink(ec)) {
+                        int sub = inotify_add_watch(fd_, it->path().c_str(), kMask | IN_ONLYDIR);
+                        if (sub >= 0) wds_[sub] = it->path();
+                    }
+                }
+                return true;
+            }
+
+            void handle(const inotify_event& ev, std::vector<Event>& out) {
+                if (ev.mask & IN_Q_OVERFLOW) { out.push_back({ Event::Kind::Overflow, {} }); return; }
+                if (ev.mask & IN_IGNORED) { wds_.erase(ev.wd); return; }
+                auto it = wds_.find(ev.wd);
+                if (it == wds_.end()) return;
+                fs::path path = ev.len ? it->second / ev.name : it->second;
+
+                if (ev.mask & (IN_CREATE | IN_MOVED_TO)) {
+                    // New directories need their own watch; files copied in
+                    // before it existed are picked up when the watcher
+                    // expands the directory at flush time.
+                    if (ev.mask & IN_ISDIR) addTree(path);
+                    out.push_back({ (ev.mask & IN_MOVED_TO) ? Event::Kind::RenamedTo : Event::Kind::Added, path });
+                } else if (ev.mask & (IN_DELETE | IN_DELETE_SELF)) {
+                    out.push_back({ Event::Kind::Removed, path });
+                } else if (ev.mask & IN_MOVED_FROM) {
+                    out.push_back({ Event::Kind::RenamedFrom, path });
+                } else if (ev.mask & (IN_MODIFY | IN_CLOSE_WRITE)) {
+                    out.push_back({ Event::Kind::Modified, path });
+                }
+            }
+
+            int fd_ = -1;
+            std::unordered_map<int, fs::path> wds_;
+        };
+    }
+
+    std::unique_ptr<Backend> makeBackend() { return std::make_unique<InotifyBackend>(); }
+
+#else
+
+    std::unique_ptr<Backend> makeBackend() { return nullptr; }
+
+#endif
+
+    bool Watcher::start(const std::vector<fs::path>& roots, Callback onChange, Options opt) {
+        stop();
+        backend_ = makeBackend();
+        if (!backend_) return false;
+        bool any = false;
+        for (const auto& root : roots) {
+            std::error_code ec;
+            if (fs::is_directory(root, ec) && backend_->addRoot(root)) any = true;
+        }
+        if (!any) { backend_.reset(); return false; }
+        onChange_ = std::move(onChange);
+        opt_ = opt;
+        stop_ = false;
+        thread_ = std::thread([this] { run(); });
+        return true;
+    }
+
+    void Watcher::stop() {
+        stop_ = true;
+        if (thread_.joinable()) thread_.join();
+        backend_.reset();
+    }
+
+    void Watcher::run() {
+        using clock = std::chrono::steady_clock;
+        enum class State { Upsert, Modified, Removed };
+
+        // Latest state per path; a file created and deleted within one burst
+        // ends up as a single removal, never as two catalog updates.
+        std::unordered_map<fs::path::string_type, State> pending;
+        bool overflow = false;
+        clock::time_point first{}, last{};
+        std::vector<Event> events;
+
+        while (!stop_) {
+            events.clear();
+            backend_->poll(events, 100);
+            const auto now = clock::now();
+
+            if (!events.empty()) {
+                if (pending.empty() && !overflow) first = now;
+                last = now;
+                for (const auto& e : events) {
+                    switch (e.kind) {
+                    case Event::Kind::Overflow:
+                        overflow = true;
+                        break;
+                    case Event::Kind::Removed:
+                    case Event::Kind::RenamedFrom:
+                        pending[e.path.native()] = State::Removed;
+                        break;
+                    case Event::Kind::Added:
+                    case Event::Kind::RenamedTo:
+                        pending[e.path.native()] = State::Upsert;
+                        break;
+                    case Event::Kind::Modified: {
+                        auto [it, inserted] = pending.try_emplace(e.path.native(), State::Modified);
+                        if (!inserted && it->second == State::Removed) it->second = State::Modified;
+                        break;
+                    }
+                    }
+                }
+            }
+
+            if (pending.empty() && !overflow) continue;
+            if (now - last < opt_.quiet && now - first < opt_.maxDelay) continue;
+
+            ChangeSet cs;
+            cs.overflow = overflow;
+            for (const auto& [key, state] : pending) {
+                fs::path path(key);
+                std::error_code ec;
+                if (state == State::Removed) {
+                    cs.removed.push_back(std::move(path));
+                } else if (fs::is_directory(path, ec)) {
+                    // Directory "modified" just means its contents changed;
+                    // those changes arrive as their own events.
+                    if (state != State::Upsert) continue;
+                    for (fs::recursive_directory_iterator it(path, fs::directory_options::skip_permission_denied, ec), end;
+                         it != end; it.increment(ec)) {
+                        if (ec) break;
+                        if (it->is_regular_file(ec)) cs.upserted.push_back(it->path());
+                    }
+                } else if (fs::exists(path, ec)) {
+                    cs.upserted.push_back(std::move(path));
+                } else {
+                    // Gone again before the burst settled.
+                    cs.removed.push_back(std::move(path));
+                }
+            }
+            pending.clear();
+            overflow = false;
+            try {
+                if (onChange_) onChange_(std::move(cs));
+            } catch (...) {
+                // Never let a bad path take the game down from this thread.
+            }
+        }
+    }
+
+} // namespace ss_watch
@@ -0,0 +1,81 @@
+// WorkshopWatcher.h
+//
+// Change notifications for the workshop roots scanned by LoadWorkshopMaps.
+// A platform backend (ReadDirectoryChangesW on Windows, inotify on Linux)
+// reports raw file events; the watcher debounces them on its own thread and
+// hands over one coalesced ChangeSet per burst, so copying hundreds of maps
+// turns into a single catalog update instead of one per file.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace ss_watch {
+    namespace fs = std::filesystem;
+
+    // A raw notification from a backend. Paths are absolute.
+    struct Event {
+        enum class Kind { Added, Removed, Modified, RenamedFrom, RenamedTo, Overflow };
+        Kind kind = Kind::Modified;
+        fs::path path;
+    };
+
+    // Platform notification source. Implementations are not thread-safe;
+    // the watcher only ever drives one from its own thread.
+    class Backend {
+    public:
+        virtual ~Backend() = default;
+        // Starts watching `root` and everything below it.
+        virtual bool addRoot(const fs::path& root) = 0;
+        // Waits up to `timeoutMs` and appends whatever arrived to `out`.
+        virtual void poll(std::vector<Event>& out, int timeoutMs) = 0;
+    };
+
+    // Returns the backend for the current platform, or null if there is none.
+    std::unique_ptr<Backend> makeBackend();
+
+    // One debounced burst of changes. Directories that appeared are already
+    // expanded into the files below them.
+    struct ChangeSet {
+        std::vector<fs::path> upserted; // files created, modified or renamed into place
+        std::vector<fs::path> removed;  // files or directories deleted or renamed away
+        bool overflow = false;          // events were lost; only a rescan is reliable
+    };
+
+    class Watcher {
+    public:
+        using Callback = std::function<void(ChangeSet&& changes)>;
+
+        struct Options {
+            std::chrono::milliseconds quiet{ 1000 };     // flush after this long without events
+            std::chrono::milliseconds maxDelay{ 10000 }; // but never hold a burst longer than this
+        };
+
+        Watcher() = default;
+        Watcher(const Watcher&) = delete;
+        Watcher& operator=(const Watcher&) = delete;
+        ~Watcher() { stop(); }
+
+        // Starts watching the roots that exist. `onChange` runs on the
+        // watcher thread. Returns false if nothing could be watched.
+        bool start(const std::vector<fs::path>& roots, Callback onChange, Options opt);
+        bool start(const std::vector<fs::path>& roots, Callback onChange) { return start(roots, std::move(onChange), Options{}); }
+        void stop();
+        bool running() const { return thread_.joinable(); }
+
+    private:
+        void run();
+
+        std::unique_ptr<Backend> backend_;
+        Callback onChange_;
+        Options opt_;
+        std::atomic<bool> stop_{ false };
+        std::thread thread_;
+    };
+}
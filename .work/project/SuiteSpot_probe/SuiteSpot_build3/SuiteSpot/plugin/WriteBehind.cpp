@@ -0,0 +1,76 @@
+// WriteBehind.cpp
+//
+// Worker loop for ss_io::WriteBehind. The worker sleeps until there is a
+// pending task, then until its deadline; every request() moves the
+// deadline, so the task only runs once requests stop.
+
+#include "pch.h"
+#include "WriteBehind.h"
+
+namespace ss_io {
+
+    using Clock = std::chrono::steady_clock;
+
+    void WriteBehind::request(Task task) {
+        ++requested_;
+        std::lock_guard<std::mutex> lk(m_);
+        pending_ = std::move(task);
+        deadline_ = Clock::now() + quiet_;
+        if (!thread_.joinable()) {
+            stopping_ = false;
+            thread_ = std::thread(&WriteBehind::run, this);
+        }
+        cv_.notify_one();
+    }
+
+    void WriteBehind::execute(Task& task) {
+        bool ok;
+        {
+            std::lock_guard<std::mutex> wl(writeMutex_);
+            ok = task();
+        }
+        if (ok) { ++performed_; return; }
+        std::lock_guard<std::mutex> lk(m_);
+        if (!pending_) {
+            pending_ = std::move(task);
+            deadline_ = Clock::now() + quiet_;
+        }
+    }
+
+    void WriteBehind::run() {
+        std::unique_lock<std::mutex> lk(m_);
+        while (!stopping_) {
+            if (!pending_) { cv_.wait(lk); continue; }
+            if (cv_.wait_until(lk, deadline_) == std::cv_status::timeout && pending_ && Clock::now() >= deadline_) {
+                Task task = std::move(pending_);
+                pending_ = nullptr;
+                lk.unlock();
+                execute(task);
+                lk.lock();
+            }
+        }
+    }
+
+    void WriteBehind::flush() {
+        Task task;
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            task = std::move(pending_);
+            pending_ = nullptr;
+        }
+        if (task) execute(task);
+    }
+
+    void WriteBehind::stop() {
+        std::thread t;
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            stopping_ = true;
+            t.swap(thread_);
+        }
+        cv_.notify_one();
+        if (t.joinable()) t.join();
+        flush();
+    }
+
+} // namespace ss_io
@@ -0,0 +1,64 @@
+// WriteBehind.h
+//
+// Debounced background writer for small settings files. Callers hand over
+// a self-contained write task (normally a lambda holding a snapshot of the
+// values to save); only the newest task is kept, and it runs on a worker
+// thread once no new request has arrived for the quiet period. A burst of
+// changes, such as dragging a value in the settings UI, therefore becomes a
+// single disk write. flush() and stop() run any pending task immediately
+// so nothing is lost at unload.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace ss_io {
+
+    class WriteBehind {
+    public:
+        // Returns false if the write failed; it is then retried after
+        // another quiet period unless a newer task replaced it.
+        using Task = std::function<bool()>;
+
+        explicit WriteBehind(std::chrono::milliseconds quiet) : quiet_(quiet) {}
+        ~WriteBehind() { stop(); }
+
+        WriteBehind(const WriteBehind&) = delete;
+        WriteBehind& operator=(const WriteBehind&) = delete;
+
+        // Replaces the pending task and restarts the quiet period.
+        void request(Task task);
+
+        // Runs the pending task, if any, on the calling thread.
+        void flush();
+
+        // Stops the worker thread, then flushes. A later request() starts
+        // the thread again.
+        void stop();
+
+        // request() calls, and tasks that ran and succeeded.
+        std::uint64_t requested() const { return requested_.load(); }
+        std::uint64_t performed() const { return performed_.load(); }
+
+    private:
+        void run();
+        void execute(Task& task);
+
+        const std::chrono::milliseconds quiet_;
+        std::mutex m_;
+        std::condition_variable cv_;
+        Task pending_;
+        std::chrono::steady_clock::time_point deadline_;
+        std::thread thread_;
+        bool stopping_ = false;
+        std::mutex writeMutex_; // one write at a time (worker vs flush)
+        std::atomic<std::uint64_t> requested_{ 0 };
+        std::atomic<std::uint64_t> performed_{ 0 };
+    };
+}